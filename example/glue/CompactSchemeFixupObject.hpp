@@ -34,11 +34,8 @@ class MM_CompactSchemeFixupObject {
 public:
 protected:
 private:
-	/*
 	OMR_VM *_omrVM;
-	MM_GCExtensionsBase *_extensions;
 	MM_CompactScheme *_compactScheme;
-	*/
 public:
 
 	/**
@@ -48,13 +45,16 @@ public:
 	 */
 	void fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Verify the forwarding address of an object: sliding compaction only moves objects down
+	 * @param objectPtr the address of the object before it was moved
+	 * @param forwardingPtr the address the object was moved to
+	 */
 	static void verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr);
 
 	MM_CompactSchemeFixupObject(MM_EnvironmentBase* env, MM_CompactScheme *compactScheme)
-/*	:
-		_omrVM(env->getOmrVM()),
-		_extensions(env->getExtensions()),
-		_compactScheme(compactScheme)*/
+		: _omrVM(env->getOmrVM())
+		, _compactScheme(compactScheme)
 	{}
 
 protected:
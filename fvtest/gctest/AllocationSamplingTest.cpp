@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "gcTestHelpers.hpp"
+
+#include "AllocationSamplingStats.hpp"
+
+#define ALLOCATION_SAMPLING_TEST_INTERVAL (512 * 1024)
+#define ALLOCATION_SAMPLING_TEST_DRAWS 200000
+
+TEST(gcFunctionalTestAllocationSampling, sizeClasses)
+{
+	ASSERT_EQ((uintptr_t)0, MM_AllocationSamplingStats::getSizeClass(1));
+	ASSERT_EQ((uintptr_t)4, MM_AllocationSamplingStats::getSizeClass(16));
+	ASSERT_EQ((uintptr_t)4, MM_AllocationSamplingStats::getSizeClass(31));
+	ASSERT_EQ((uintptr_t)5, MM_AllocationSamplingStats::getSizeClass(32));
+	ASSERT_EQ((uintptr_t)(ALLOCATION_SAMPLING_SIZE_CLASSES - 1), MM_AllocationSamplingStats::getSizeClass(UDATA_MAX));
+}
+
+TEST(gcFunctionalTestAllocationSampling, intervalsAreExponential)
+{
+	uint64_t seed = 0x2545F4914F6CDD1DULL;
+	uint64_t total = 0;
+	uintptr_t belowMean = 0;
+	for (uintptr_t i = 0; i < ALLOCATION_SAMPLING_TEST_DRAWS; i++) {
+		uintptr_t interval = MM_AllocationSamplingStats::nextSampleInterval(&seed, ALLOCATION_SAMPLING_TEST_INTERVAL);
+		ASSERT_LE((uintptr_t)1, interval);
+		ASSERT_NE((uint64_t)0, seed);
+		total += interval;
+		if (interval < ALLOCATION_SAMPLING_TEST_INTERVAL) {
+			belowMean += 1;
+		}
+	}
+
+	/* the sample mean is within 2% of the requested mean and, as for any exponential distribution,
+	 * 1 - 1/e (63.2%) of the intervals are shorter than the mean
+	 */
+	double mean = (double)total / ALLOCATION_SAMPLING_TEST_DRAWS;
+	ASSERT_NEAR((double)ALLOCATION_SAMPLING_TEST_INTERVAL, mean, ALLOCATION_SAMPLING_TEST_INTERVAL * 0.02);
+	ASSERT_NEAR(0.632, (double)belowMean / ALLOCATION_SAMPLING_TEST_DRAWS, 0.01);
+}
+
+TEST(gcFunctionalTestAllocationSampling, estimateAndRecord)
+{
+	/* small objects stand for about one interval worth of allocation, objects much larger than the interval only for themselves */
+	uintptr_t smallEstimate = MM_AllocationSamplingStats::estimateSampledBytes(64, ALLOCATION_SAMPLING_TEST_INTERVAL);
+	ASSERT_NEAR((double)ALLOCATION_SAMPLING_TEST_INTERVAL, (double)smallEstimate, 64.0);
+	uintptr_t largeSize = 64 * ALLOCATION_SAMPLING_TEST_INTERVAL;
+	ASSERT_EQ(largeSize, MM_AllocationSamplingStats::estimateSampledBytes(largeSize, ALLOCATION_SAMPLING_TEST_INTERVAL));
+	for (uintptr_t size = 16; size < largeSize; size *= 3) {
+		ASSERT_LE(size, MM_AllocationSamplingStats::estimateSampledBytes(size, ALLOCATION_SAMPLING_TEST_INTERVAL));
+	}
+
+	MM_AllocationSamplingStats stats;
+	stats.recordSample(48, smallEstimate);
+	stats.recordSample(40, smallEstimate);
+	stats.recordSample(largeSize, largeSize);
+	uintptr_t sizeClass = MM_AllocationSamplingStats::getSizeClass(48);
+	ASSERT_EQ((uintptr_t)2, stats._sampleCount[sizeClass]);
+	ASSERT_EQ((uint64_t)88, stats._sampledBytes[sizeClass]);
+	ASSERT_EQ((uint64_t)(2 * smallEstimate), stats._estimatedBytes[sizeClass]);
+	ASSERT_EQ((uintptr_t)1, stats._sampleCount[MM_AllocationSamplingStats::getSizeClass(largeSize)]);
+
+	stats.clear();
+	for (uintptr_t i = 0; i < ALLOCATION_SAMPLING_SIZE_CLASSES; i++) {
+		ASSERT_EQ((uintptr_t)0, stats._sampleCount[i]);
+		ASSERT_EQ((uint64_t)0, stats._estimatedBytes[i]);
+	}
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "gcTestHelpers.hpp"
+
+#include "CardScanner.hpp"
+
+#define CARDSCAN_TEST_CARDS 1024
+#define CARDSCAN_BENCHMARK_CARDS (16 * 1024 * 1024)
+#define CARDSCAN_BENCHMARK_ITERATIONS 8
+
+typedef enum {
+	CARDSCAN_BYTE = 0, /**< one card at a time */
+	CARDSCAN_WORD, /**< a uintptr_t of cards at a time, as card cleaning did before MM_CardScanner */
+	CARDSCAN_BLOCK, /**< MM_CardScanner::skipCleanCards() */
+	CARDSCAN_MODES
+} CardScanMode;
+
+static const char *cardScanModeNames[] = {"byte", "word", "block"};
+
+/**
+ * Find the first card that is not clean in [card, cardTop) a uintptr_t at a time once aligned.
+ */
+static Card *
+skipCleanCardsByWord(Card *card, Card *cardTop)
+{
+	while ((card < cardTop) && (0 != ((uintptr_t)card % sizeof(uintptr_t))) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	if ((card < cardTop) && ((Card)CARD_CLEAN == *card)) {
+		uintptr_t *slot = (uintptr_t *)card;
+		uintptr_t *slotTop = (uintptr_t *)((uintptr_t)cardTop & ~(sizeof(uintptr_t) - 1));
+		while ((slot < slotTop) && (0 == *slot)) {
+			slot += 1;
+		}
+		card = MM_CardScanner::skipCleanCardsScalar((Card *)slot, cardTop);
+	}
+	return card;
+}
+
+/**
+ * Visit each card that is not clean the way card cleaning does.
+ * @return the number of cards that are not clean
+ */
+static uintptr_t
+scanCardTable(Card *cardTable, Card *cardTableTop, CardScanMode mode)
+{
+	uintptr_t unclean = 0;
+	Card *card = cardTable;
+	while (card < cardTableTop) {
+		switch (mode) {
+		case CARDSCAN_BYTE:
+			card = MM_CardScanner::skipCleanCardsScalar(card, cardTableTop);
+			break;
+		case CARDSCAN_WORD:
+			card = skipCleanCardsByWord(card, cardTableTop);
+			break;
+		default:
+			card = MM_CardScanner::skipCleanCards(card, cardTableTop);
+			break;
+		}
+		if (card < cardTableTop) {
+			unclean += 1;
+			card += 1;
+		}
+	}
+	return unclean;
+}
+
+/**
+ * Set roughly one card in every dirtyCardInterval cards to a value that is not clean.
+ */
+static void
+fillCardTable(Card *cardTable, uintptr_t cards, uintptr_t dirtyCardInterval)
+{
+	const Card values[] = {CARD_DIRTY, CARD_REMEMBERED, CARD_INVALID};
+	uint32_t seed = 0x9E3779B9;
+	for (uintptr_t i = 0; i < cards; i++) {
+		seed = (seed * 1103515245) + 12345;
+		cardTable[i] = (0 == ((seed >> 8) % dirtyCardInterval)) ? values[(seed >> 3) % 3] : (Card)CARD_CLEAN;
+	}
+}
+
+TEST(gcFunctionalTestCardScanner, matchesScalarScan)
+{
+	/* over-allocate so that every alignment of the range start can be tried */
+	Card cardTable[CARDSCAN_TEST_CARDS + 64];
+	const Card values[] = {CARD_DIRTY, CARD_REMEMBERED, CARD_INVALID};
+
+	for (uintptr_t start = 0; start < 64; start++) {
+		for (uintptr_t value = 0; value < sizeof(values) / sizeof(values[0]); value++) {
+			for (uintptr_t dirty = start; dirty <= CARDSCAN_TEST_CARDS; dirty++) {
+				memset(cardTable, CARD_CLEAN, sizeof(cardTable));
+				cardTable[dirty] = values[value];
+				Card *expected = MM_CardScanner::skipCleanCardsScalar(cardTable + start, cardTable + CARDSCAN_TEST_CARDS);
+				ASSERT_EQ(cardTable + OMR_MIN(dirty, (uintptr_t)CARDSCAN_TEST_CARDS), expected);
+				ASSERT_EQ(expected, MM_CardScanner::skipCleanCards(cardTable + start, cardTable + CARDSCAN_TEST_CARDS));
+			}
+		}
+	}
+
+	for (uintptr_t interval = 1; interval <= 4096; interval *= 4) {
+		fillCardTable(cardTable, CARDSCAN_TEST_CARDS, interval);
+		for (uintptr_t end = CARDSCAN_TEST_CARDS - 40; end <= CARDSCAN_TEST_CARDS; end++) {
+			ASSERT_EQ(scanCardTable(cardTable, cardTable + end, CARDSCAN_BYTE), scanCardTable(cardTable, cardTable + end, CARDSCAN_BLOCK));
+		}
+	}
+}
+
+TEST(perfTestCardScanner, scanSyntheticCardTables)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const uintptr_t dirtyCardIntervals[] = {2, 16, 256, 4096, 65536};
+
+	Card *cardTable = (Card *)omrmem_allocate_memory(CARDSCAN_BENCHMARK_CARDS, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != cardTable);
+
+	for (uintptr_t i = 0; i < sizeof(dirtyCardIntervals) / sizeof(dirtyCardIntervals[0]); i++) {
+		fillCardTable(cardTable, CARDSCAN_BENCHMARK_CARDS, dirtyCardIntervals[i]);
+		uint64_t elapsed[CARDSCAN_MODES];
+		uintptr_t unclean[CARDSCAN_MODES];
+		for (uintptr_t mode = 0; mode < CARDSCAN_MODES; mode++) {
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t iteration = 0; iteration < CARDSCAN_BENCHMARK_ITERATIONS; iteration++) {
+				unclean[mode] = scanCardTable(cardTable, cardTable + CARDSCAN_BENCHMARK_CARDS, (CardScanMode)mode);
+			}
+			elapsed[mode] = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			ASSERT_EQ(unclean[0], unclean[mode]);
+		}
+		gcTestEnv->log("1/%zu dirty cards: %zu dirty, %s %llu us, %s %llu us, %s %llu us\n",
+			(size_t)dirtyCardIntervals[i], (size_t)unclean[0],
+			cardScanModeNames[CARDSCAN_BYTE], (unsigned long long)elapsed[CARDSCAN_BYTE],
+			cardScanModeNames[CARDSCAN_WORD], (unsigned long long)elapsed[CARDSCAN_WORD],
+			cardScanModeNames[CARDSCAN_BLOCK], (unsigned long long)elapsed[CARDSCAN_BLOCK]);
+	}
+
+	omrmem_free_memory(cardTable);
+}
@@ -0,0 +1,364 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "gcTestHelpers.hpp"
+
+#include "AtomicOperations.hpp"
+#include "CardCleaner.hpp"
+#include "CardScanner.hpp"
+#include "CardTable.hpp"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentCardTable.hpp"
+#include "Dispatcher.hpp"
+#include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelTask.hpp"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#define SUMMARY_TEST_CARDS (64 * CARDS_PER_SUMMARY_CARD)
+/* 64GB of heap at CARD_SIZE bytes per card */
+#define SUMMARY_BENCHMARK_CARDS (((uintptr_t)64 << 30) >> CARD_SIZE_SHIFT)
+#define SUMMARY_BENCHMARK_ITERATIONS 4
+
+/**
+ * Count the dirty cards in [firstCard, lastCard) of a simulated card table, stepping over clean blocks of cards
+ * and, when a summary table is given, over clean summary cards.  The benchmark tables are not attached to a heap,
+ * so this repeats the scan loop of MM_ConcurrentCardTable::getNextDirtyCard() around the same skip helpers.
+ * @return the number of dirty cards found
+ */
+static uintptr_t
+countDirtyCards(Card *cardTable, Card *summaryTable, Card *firstCard, Card *lastCard)
+{
+	uintptr_t dirtyCards = 0;
+	Card *summarySpanTop = (NULL != summaryTable) ? firstCard : lastCard;
+	for (Card *currentCard = firstCard; currentCard < lastCard; currentCard++) {
+		while ((currentCard < lastCard) && ((Card)CARD_CLEAN == *currentCard)) {
+			if (currentCard >= summarySpanTop) {
+				currentCard = MM_CardTable::skipCleanSummaryCards(cardTable, summaryTable, currentCard, lastCard);
+				summarySpanTop = cardTable + ((((uintptr_t)(currentCard - cardTable) >> CARD_SUMMARY_SHIFT) + 1) << CARD_SUMMARY_SHIFT);
+				summarySpanTop = OMR_MIN(summarySpanTop, lastCard);
+			}
+			currentCard = MM_CardScanner::skipCleanCards(currentCard, summarySpanTop);
+		}
+		if (currentCard >= lastCard) {
+			break;
+		}
+		if ((Card)CARD_DIRTY == *currentCard) {
+			dirtyCards += 1;
+		}
+	}
+	return dirtyCards;
+}
+
+/**
+ * Dirty roughly one card in every dirtyCardInterval cards, and their summary cards.
+ * @return the number of cards dirtied
+ */
+static uintptr_t
+fillCardTable(Card *cardTable, Card *summaryTable, uintptr_t cards, uintptr_t dirtyCardInterval, uint32_t seed)
+{
+	memset(cardTable, CARD_CLEAN, cards);
+	memset(summaryTable, CARD_CLEAN, MM_CardTable::calculateSummaryTableSize(cards));
+	uintptr_t dirtyCards = 0;
+	if (0 != dirtyCardInterval) {
+		for (uintptr_t i = 0; i < cards / dirtyCardInterval; i++) {
+			seed = (seed * 1103515245) + 12345;
+			uintptr_t card = (((uintptr_t)seed << 16) ^ (seed >> 8)) % cards;
+			if ((Card)CARD_DIRTY != cardTable[card]) {
+				cardTable[card] = (Card)CARD_DIRTY;
+				summaryTable[card >> CARD_SUMMARY_SHIFT] = (Card)CARD_DIRTY;
+				dirtyCards += 1;
+			}
+		}
+	}
+	return dirtyCards;
+}
+
+TEST(gcFunctionalTestCardTableSummary, skipCleanSummaryCards)
+{
+	Card *cardTable = (Card *)malloc(SUMMARY_TEST_CARDS);
+	Card *summaryTable = (Card *)malloc(MM_CardTable::calculateSummaryTableSize(SUMMARY_TEST_CARDS));
+	ASSERT_TRUE((NULL != cardTable) && (NULL != summaryTable));
+
+	/* The summary card of a single dirty card must be found from every start position in and before it */
+	uintptr_t dirtyCard = (3 * CARDS_PER_SUMMARY_CARD) + 17;
+	fillCardTable(cardTable, summaryTable, SUMMARY_TEST_CARDS, 0, 0);
+	cardTable[dirtyCard] = (Card)CARD_DIRTY;
+	summaryTable[dirtyCard >> CARD_SUMMARY_SHIFT] = (Card)CARD_DIRTY;
+	for (uintptr_t start = 0; start <= dirtyCard; start++) {
+		Card *expected = cardTable + OMR_MAX(start, 3 * CARDS_PER_SUMMARY_CARD);
+		ASSERT_EQ(expected, MM_CardTable::skipCleanSummaryCards(cardTable, summaryTable, cardTable + start, cardTable + SUMMARY_TEST_CARDS));
+	}
+	ASSERT_EQ(cardTable + dirtyCard, MM_CardTable::skipCleanSummaryCards(cardTable, summaryTable, cardTable + dirtyCard, cardTable + dirtyCard));
+
+	/* With no dirty summary cards the whole range is skipped */
+	summaryTable[dirtyCard >> CARD_SUMMARY_SHIFT] = (Card)CARD_CLEAN;
+	ASSERT_EQ(cardTable + SUMMARY_TEST_CARDS, MM_CardTable::skipCleanSummaryCards(cardTable, summaryTable, cardTable + 5, cardTable + SUMMARY_TEST_CARDS));
+
+	free(summaryTable);
+	free(cardTable);
+}
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+/**
+ * Card cleaner which counts the cards it is handed, per card, and cleans them.
+ */
+class MM_SummaryTestCardCleaner : public MM_CardCleaner
+{
+public:
+	Card *_cardTableStart;
+	uint8_t *_timesCleaned; /**< one counter per card from _cardTableStart */
+	volatile uintptr_t _cardsCleaned;
+
+	virtual void clean(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, Card *cardToClean)
+	{
+		_timesCleaned[cardToClean - _cardTableStart] += 1;
+		*cardToClean = (Card)CARD_CLEAN;
+		MM_AtomicOperations::add(&_cardsCleaned, 1);
+	}
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_CARD_CLEANER_FOR_MARKING; }
+
+	MM_SummaryTestCardCleaner(Card *cardTableStart, uint8_t *timesCleaned)
+		: MM_CardCleaner()
+		, _cardTableStart(cardTableStart)
+		, _timesCleaned(timesCleaned)
+		, _cardsCleaned(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Cleans the cards of a heap range on every dispatcher thread, either through MM_CardTable::cleanCardTableForRange()
+ * with a card cleaner or through MM_ConcurrentCardTable::finalCleanCards(), which hands out one dirty card at a time.
+ */
+class MM_SummaryTestCleanCardsTask : public MM_ParallelTask
+{
+private:
+	MM_ConcurrentCardTable *_cardTable;
+	MM_CardCleaner *_cardCleaner;
+	void *_lowAddress;
+	void *_highAddress;
+
+public:
+	volatile uintptr_t _bytesTraced;
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_CONCURRENT_MARK_FINAL_CLEAN_CARDS; }
+
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		if (NULL != _cardCleaner) {
+			_cardTable->cleanCardTableForRange(env, _cardCleaner, _lowAddress, _highAddress);
+		} else {
+			uintptr_t bytesTraced = 0;
+			while (_cardTable->finalCleanCards(env, &bytesTraced)) {
+				MM_AtomicOperations::add(&_bytesTraced, bytesTraced);
+			}
+			MM_AtomicOperations::add(&_bytesTraced, bytesTraced);
+		}
+	}
+
+	MM_SummaryTestCleanCardsTask(MM_EnvironmentBase *env, MM_ConcurrentCardTable *cardTable, MM_CardCleaner *cardCleaner, void *lowAddress, void *highAddress)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _cardTable(cardTable)
+		, _cardCleaner(cardCleaner)
+		, _lowAddress(lowAddress)
+		, _highAddress(highAddress)
+		, _bytesTraced(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Drives card cleaning of the card table of a heap started with -Xgc:summaryCardTable.  No collection runs before the
+ * tests, so the mark map is empty and final card cleaning cleans the cards without tracing anything.
+ */
+class CardTableSummaryTest : public GCConfigTest
+{
+protected:
+	MM_ConcurrentCardTable *cardTable;
+	void *lowAddress;
+	void *highAddress;
+	uintptr_t cards;
+
+	virtual void SetUp()
+	{
+		GCConfigTest::SetUp();
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		cardTable = (MM_ConcurrentCardTable *)extensions->cardTable;
+		ASSERT_TRUE(NULL != cardTable);
+		ASSERT_TRUE(NULL != cardTable->getSummaryTableStart());
+
+		/* the flat tenure space is a single region, whose cards are the ones cleaned concurrently */
+		lowAddress = NULL;
+		highAddress = NULL;
+		GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+		MM_HeapRegionDescriptor *region = NULL;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (region->getSubSpace()->isConcurrentCollectable()) {
+				ASSERT_TRUE(NULL == lowAddress);
+				lowAddress = region->getLowAddress();
+				highAddress = region->getHighAddress();
+			}
+		}
+		ASSERT_TRUE(NULL != lowAddress);
+		cards = cardTable->heapAddrToCardAddr(env, highAddress) - cardTable->heapAddrToCardAddr(env, lowAddress);
+		ASSERT_LT(2 * CARDS_PER_SUMMARY_CARD, cards);
+	}
+
+	/**
+	 * Clear the cards of the range and dirty roughly one card in every dirtyCardInterval cards, or only the card at
+	 * index dirtyCardInterval if seed is 0, through MM_CardTable::dirtyCard().
+	 * @param[out] dirtied one byte per card, set for each card dirtied
+	 * @return the number of cards dirtied
+	 */
+	uintptr_t
+	dirtyCards(uint8_t *dirtied, uintptr_t dirtyCardInterval, uint32_t seed)
+	{
+		cardTable->clearCardsInRange(env, lowAddress, highAddress);
+		memset(dirtied, 0, cards);
+		uintptr_t dirtyCardCount = 0;
+		uintptr_t draws = (0 == seed) ? 1 : (cards / dirtyCardInterval);
+		for (uintptr_t i = 0; i < draws; i++) {
+			uintptr_t card = dirtyCardInterval;
+			if (0 != seed) {
+				seed = (seed * 1103515245) + 12345;
+				card = (((uintptr_t)seed << 16) ^ (seed >> 8)) % cards;
+			}
+			if (0 == dirtied[card]) {
+				cardTable->dirtyCard(env, (omrobjectptr_t)((uintptr_t)lowAddress + (card * CARD_SIZE)));
+				dirtied[card] = 1;
+				dirtyCardCount += 1;
+			}
+		}
+		return dirtyCardCount;
+	}
+
+	/**
+	 * Run a card cleaning task on all the dispatcher threads.
+	 */
+	void
+	cleanCards(MM_SummaryTestCleanCardsTask *task)
+	{
+		env->acquireExclusiveVMAccess();
+		env->getExtensions()->dispatcher->run(env, task);
+		env->releaseExclusiveVMAccess();
+	}
+};
+
+TEST_P(CardTableSummaryTest, cleanRange)
+{
+	Card *firstCard = cardTable->heapAddrToCardAddr(env, lowAddress);
+	uint8_t *dirtied = (uint8_t *)malloc(cards);
+	uint8_t *timesCleaned = (uint8_t *)malloc(cards);
+	ASSERT_TRUE((NULL != dirtied) && (NULL != timesCleaned));
+
+	/* single dirty cards at either end and inside a summary card, then random patterns */
+	const uintptr_t singleCards[] = {0, CARDS_PER_SUMMARY_CARD - 1, CARDS_PER_SUMMARY_CARD + 17, cards - 1};
+	const uintptr_t dirtyCardIntervals[] = {1, 7, 100, 1000};
+	for (uintptr_t pattern = 0; pattern < 12; pattern++) {
+		uintptr_t dirtyCardCount = (pattern < 4)
+			? dirtyCards(dirtied, singleCards[pattern], 0)
+			: dirtyCards(dirtied, dirtyCardIntervals[pattern % 4], (uint32_t)pattern);
+		memset(timesCleaned, 0, cards);
+		MM_SummaryTestCardCleaner cardCleaner(firstCard, timesCleaned);
+		MM_SummaryTestCleanCardsTask task(env, cardTable, &cardCleaner, lowAddress, highAddress);
+		cleanCards(&task);
+
+		/* each dirty card was handed to the cleaner once, and no clean card was */
+		ASSERT_EQ(dirtyCardCount, cardCleaner._cardsCleaned);
+		for (uintptr_t card = 0; card < cards; card++) {
+			ASSERT_EQ(dirtied[card], timesCleaned[card]) << "card " << card << " of pattern " << pattern;
+			ASSERT_EQ((Card)CARD_CLEAN, firstCard[card]);
+		}
+	}
+
+	free(timesCleaned);
+	free(dirtied);
+}
+
+TEST_P(CardTableSummaryTest, getNextDirtyCard)
+{
+	Card *firstCard = cardTable->heapAddrToCardAddr(env, lowAddress);
+	uint8_t *dirtied = (uint8_t *)malloc(cards);
+	ASSERT_TRUE(NULL != dirtied);
+
+	const uintptr_t dirtyCardIntervals[] = {1, 7, 100, 1000};
+	for (uintptr_t pattern = 0; pattern < 8; pattern++) {
+		uintptr_t dirtyCardCount = dirtyCards(dirtied, dirtyCardIntervals[pattern % 4], (uint32_t)pattern + 1);
+		uintptr_t finalCleanedCards = cardTable->getCardTableStats()->getFinalCleanedCards();
+		cardTable->initializeFinalCardCleaning(env);
+		MM_SummaryTestCleanCardsTask task(env, cardTable, NULL, lowAddress, highAddress);
+		cleanCards(&task);
+
+		/* getNextDirtyCard() handed every dirty card out exactly once across the threads */
+		ASSERT_EQ(dirtyCardCount, cardTable->getCardTableStats()->getFinalCleanedCards() - finalCleanedCards);
+		ASSERT_EQ(0U, task._bytesTraced);
+		for (uintptr_t card = 0; card < cards; card++) {
+			ASSERT_EQ((Card)CARD_CLEAN, firstCard[card]) << "card " << card << " of pattern " << pattern;
+		}
+	}
+
+	free(dirtied);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTestCardTableSummary, CardTableSummaryTest,
+	::testing::Values("fvtest/gctest/configuration/optavgpause_GC_summarycardtable_config.xml"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+TEST(perfTestCardTableSummary, scanSimulated64GBHeap)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	/* expected fraction of dirty cards is 1/interval, 0 for none */
+	const uintptr_t dirtyCardIntervals[] = {0, 1000000, 100000, 10000, 1000, 100};
+
+	Card *cardTable = (Card *)omrmem_allocate_memory(SUMMARY_BENCHMARK_CARDS, OMRMEM_CATEGORY_MM);
+	Card *summaryTable = (Card *)omrmem_allocate_memory(MM_CardTable::calculateSummaryTableSize(SUMMARY_BENCHMARK_CARDS), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE((NULL != cardTable) && (NULL != summaryTable));
+
+	for (uintptr_t i = 0; i < sizeof(dirtyCardIntervals) / sizeof(dirtyCardIntervals[0]); i++) {
+		uintptr_t dirtied = fillCardTable(cardTable, summaryTable, SUMMARY_BENCHMARK_CARDS, dirtyCardIntervals[i], 0x9E3779B9);
+		uint64_t elapsed[2] = {0, 0};
+		uintptr_t dirtyCards[2] = {0, 0};
+		for (uintptr_t mode = 0; mode < 2; mode++) {
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t iteration = 0; iteration < SUMMARY_BENCHMARK_ITERATIONS; iteration++) {
+				dirtyCards[mode] = countDirtyCards(cardTable, (1 == mode) ? summaryTable : NULL, cardTable, cardTable + SUMMARY_BENCHMARK_CARDS);
+			}
+			elapsed[mode] = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		}
+		ASSERT_EQ(dirtied, dirtyCards[0]);
+		ASSERT_EQ(dirtyCards[0], dirtyCards[1]);
+		gcTestEnv->log("64GB heap, dirty card interval %zu: %zu dirty, linear scan %llu us, summary scan %llu us\n",
+			(size_t)dirtyCardIntervals[i], (size_t)dirtyCards[0], (unsigned long long)elapsed[0], (unsigned long long)elapsed[1]);
+	}
+
+	omrmem_free_memory(summaryTable);
+	omrmem_free_memory(cardTable);
+}
@@ -19,20 +19,34 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "IncrementalHeapWalker.hpp"
+#include "mmomrhook.h"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryConverter.hpp"
 #include "VerboseWriterChain.hpp"
 
+#if defined(LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
 //#define OMRGCTEST_PRINTFILE
 
 #define MAX_NAME_LENGTH 512
+/* used to judge the locality of objects, it need not match the hardware */
+#define OMRGCTEST_CACHE_LINE_SIZE 64
 #define OMRGCTEST_CHECK_RT(rt) \
 	if (0 != (rt)) {\
 		goto done;\
@@ -43,21 +57,82 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workpacketstealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_queuedlocks_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_markingprefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_freelistindex_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_asynclogging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binarylogging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_allocationsampling_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_incrementalheapwalk_config.xml"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_summarycardtable_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/global_GC_lazysweep_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compactincrement_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numalocal_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_thp_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_remsetshards_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_hierarchicalcopy_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_incrementalheapwalk_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_adaptivetlh_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/scavenger_scan_shared_1threads.xml"
+								, "perftest/gctest/configuration/scavenger_scan_shared_4threads.xml"
+								, "perftest/gctest/configuration/scavenger_scan_shared_8threads.xml"
+								, "perftest/gctest/configuration/scavenger_scan_stealing_1threads.xml"
+								, "perftest/gctest/configuration/scavenger_scan_stealing_4threads.xml"
+								, "perftest/gctest/configuration/scavenger_scan_stealing_8threads.xml"
+								, "perftest/gctest/configuration/scavenger_prefetch_list_off.xml"
+								, "perftest/gctest/configuration/scavenger_prefetch_list_on.xml"
+								, "perftest/gctest/configuration/scavenger_prefetch_array_off.xml"
+								, "perftest/gctest/configuration/scavenger_prefetch_array_on.xml"
+								, "perftest/gctest/configuration/thp_list_off.xml"
+								, "perftest/gctest/configuration/thp_list_on.xml"
+								, "perftest/gctest/configuration/hierarchicalcopy_off.xml"
+								, "perftest/gctest/configuration/hierarchicalcopy_on.xml"
+#endif
+								, "perftest/gctest/configuration/marking_prefetch_off.xml"
+								, "perftest/gctest/configuration/marking_prefetch_on.xml"
+								, "perftest/gctest/configuration/binarylogging_off.xml"
+								, "perftest/gctest/configuration/binarylogging_on.xml"
+								, "perftest/gctest/configuration/allocationsampling_off.xml"
+								, "perftest/gctest/configuration/allocationsampling_on.xml"
+								, "perftest/gctest/configuration/incrementalheapwalk.xml"
+								, "perftest/gctest/configuration/adaptivetlh_off.xml"
+								, "perftest/gctest/configuration/adaptivetlh_on.xml"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/sizeclassallocation_segregated.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/sizeclassallocation_gencon.xml"
+#endif
+#endif
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+								, "perftest/gctest/configuration/lazysweep_off.xml"
+								, "perftest/gctest/configuration/lazysweep_on.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -116,6 +191,13 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	/* count the allocation samples reported to listeners so that they can be checked against the histogram */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->allocationSampling) {
+		J9HookInterface **omrHooks = extensions->getOmrHookInterface();
+		(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, OMR_GET_CALLSITE(), (void *)this);
+	}
+
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -132,6 +214,11 @@ GCConfigTest::TearDown()
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
+	if ((NULL != env) && env->getExtensions()->allocationSampling) {
+		J9HookInterface **omrHooks = env->getExtensions()->getOmrHookInterface();
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, (void *)this);
+	}
+
 	/* Free root hash table */
 	if (NULL != exampleVM->rootTable) {
 		hashTableFree(exampleVM->rootTable);
@@ -809,6 +896,44 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Load a verbose log, converting it to XML first if it was written with -Xgc:binaryLogging.
+ * @param[out] result the result of parsing the (converted) log
+ * @return false if a binary log could not be converted, true otherwise
+ */
+static bool
+loadVerboseLog(pugi::xml_document &verboseDoc, const char *fileName, pugi::xml_parse_result &result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	if (!MM_VerboseBinaryConverter::isBinaryLog(gcTestEnv->portLib, fileName)) {
+		result = verboseDoc.load_file(fileName);
+		return true;
+	}
+
+	const char *suffix = ".converted";
+	uintptr_t convertedFileLength = strlen(fileName) + strlen(suffix) + 1;
+	char *convertedFile = (char *)omrmem_allocate_memory(convertedFileLength, OMRMEM_CATEGORY_MM);
+	if (NULL == convertedFile) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		return false;
+	}
+	omrstr_printf(convertedFile, convertedFileLength, "%s%s", fileName, suffix);
+	bool converted = MM_VerboseBinaryConverter::convert(gcTestEnv->portLib, fileName, convertedFile);
+	if (converted) {
+		result = verboseDoc.load_file(convertedFile);
+#if defined(OMRGCTEST_PRINTFILE)
+		printFile(convertedFile);
+#endif
+	} else {
+		gcTestEnv->log(LEVEL_ERROR, "*FAILED* Binary verbose log %s is incomplete.\n", fileName);
+	}
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(convertedFile);
+	}
+	omrmem_free_memory((void *)convertedFile);
+	return converted;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -826,11 +951,18 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	/* output may still be queued in an asynchronous writer */
+	verboseManager->flushStreams(env);
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			if (!loadVerboseLog(verboseDoc, verboseFile, result)) {
+				rt = 1;
+				goto done;
+			}
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +970,10 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			if (!loadVerboseLog(verboseDoc, currentVerboseFile, result)) {
+				rt = 1;
+				goto done;
+			}
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -973,12 +1108,273 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "incrementalHeapWalk")) {
+			rt = incrementalHeapWalk(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "sizeClassAllocation")) {
+			rt = sizeClassAllocation(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "objectGraphWalk")) {
+			rt = objectGraphWalk(node);
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
 	return rt;
 }
 
+typedef struct HeapWalkTally {
+	volatile uintptr_t objects;
+	volatile uintptr_t addressSum;
+} HeapWalkTally;
+
+static void
+tallyObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkTally *tally = (HeapWalkTally *)userData;
+	MM_AtomicOperations::add(&tally->objects, 1);
+	MM_AtomicOperations::add(&tally->addressSum, (uintptr_t)object);
+}
+
+/**
+ * Walk the heap incrementally with the budgets given by the node and check that exactly the objects found
+ * by a stop-the-world walk are reported. Then check that a collection between increments abandons the walk.
+ */
+int32_t
+GCConfigTest::incrementalHeapWalk(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	uint64_t timeBudget = (uint64_t)node.attribute("timeBudget").as_llong();
+	uintptr_t objectBudget = (uintptr_t)node.attribute("objectBudget").as_ullong();
+	int32_t rt = 0;
+
+	MM_IncrementalHeapWalker *incrementalHeapWalker = MM_IncrementalHeapWalker::newInstance(env, globalCollector);
+	if (NULL == incrementalHeapWalker) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create the incremental heap walker.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* start() completes a pending lazy sweep, so the stop-the-world walk follows it at the same safepoint */
+	HeapWalkTally expected = {0, 0};
+	HeapWalkTally walked = {0, 0};
+	uintptr_t increments = 0;
+	uint64_t longestIncrement = 0;
+	IncrementalHeapWalkResult result = INCREMENTAL_HEAP_WALK_PAUSED;
+	env->acquireExclusiveVMAccess();
+	bool started = incrementalHeapWalker->start(env, tallyObject, &walked, 0, false);
+	uintptr_t chunks = incrementalHeapWalker->getChunkCount();
+	uint64_t startTime = omrtime_hires_clock();
+	globalCollector->getHeapWalker()->allObjectsDo(env, tallyObject, &expected, 0, true, false);
+	uint64_t fullWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	env->releaseExclusiveVMAccess();
+	while (started && (INCREMENTAL_HEAP_WALK_PAUSED == result)) {
+		/* each increment is a separate safepoint */
+		env->acquireExclusiveVMAccess();
+		startTime = omrtime_hires_clock();
+		result = incrementalHeapWalker->walk(env, timeBudget, objectBudget);
+		longestIncrement = OMR_MAX(longestIncrement, omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+		env->releaseExclusiveVMAccess();
+		increments += 1;
+	}
+	gcTestEnv->log("Heap walk: %zu objects in %llu us stop-the-world; %zu objects from %zu chunks in %zu increments of at most %llu us incrementally\n",
+		expected.objects, fullWalkTime, walked.objects, chunks, increments, longestIncrement);
+	if (!started || (INCREMENTAL_HEAP_WALK_COMPLETED != result) || (expected.objects != walked.objects) || (expected.addressSum != walked.addressSum)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Incremental heap walk (result %d) reported %zu objects, expected %zu.\n", __FILE__, __LINE__, (int)result, walked.objects, expected.objects);
+		rt = 1;
+	} else if ((0 != objectBudget) && (expected.objects > (2 * objectBudget)) && (1 == increments)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Incremental heap walk ignored its object budget.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+
+	if (0 == rt) {
+		env->acquireExclusiveVMAccess();
+		started = incrementalHeapWalker->start(env, tallyObject, &walked, 0, true);
+		result = incrementalHeapWalker->walk(env, 0, 1);
+		env->releaseExclusiveVMAccess();
+		if (started && (INCREMENTAL_HEAP_WALK_PAUSED == result)) {
+			OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+			env->acquireExclusiveVMAccess();
+			result = incrementalHeapWalker->walk(env, 0, 1);
+			env->releaseExclusiveVMAccess();
+			if ((INCREMENTAL_HEAP_WALK_INVALIDATED != result) || incrementalHeapWalker->isWalkActive()) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Incremental heap walk survived a collection (result %d).\n", __FILE__, __LINE__, (int)result);
+				rt = 1;
+			}
+		}
+	}
+
+	incrementalHeapWalker->kill(env);
+	return rt;
+}
+
+/**
+ * Allocate the number of unreferenced objects given by the node in every small size class (see MM_SizeClasses)
+ * and report the mean time per allocation of each size class. Any policy can run this, for comparison with
+ * the segregated heap.
+ */
+int32_t
+GCConfigTest::sizeClassAllocation(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	static const uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+	uintptr_t count = OMR_MAX((uintptr_t)node.attribute("count").as_ullong(), 1);
+	uint64_t totalTime = 0;
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; (0 == rt) && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+		uintptr_t size = cellSizes[sizeClass];
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < count; i++) {
+			MM_ObjectAllocationModel *allocationModel = new(objectAllocationModelSpace)
+					MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+			if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel)) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate an object of size 0x%zx.\n", __FILE__, __LINE__, size);
+				rt = 1;
+				break;
+			}
+		}
+		uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		totalTime += elapsed;
+		gcTestEnv->log("Size class %zu (%zu bytes): %llu ns per allocation\n", sizeClass, size, elapsed / count);
+	}
+	gcTestEnv->log("Time elapsed in size class allocation: %llu ms\n", totalTime / 1000000);
+#else /* OMR_GC_SEGREGATED_HEAP */
+	gcTestEnv->log("Size class allocation skipped, requires OMR_GC_SEGREGATED_HEAP.\n");
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	return rt;
+}
+
+#if defined(LINUX)
+/**
+ * Open a counter for a hardware cache event of the calling thread, user space only.
+ * @return the counter file descriptor, or -1 if the kernel does not let the process count the event
+ */
+static int
+openCacheEventCounter(uint64_t config)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif /* defined(LINUX) */
+
+/**
+ * Walk the object graph depth first from every root, the number of times given by the node, the way a mutator
+ * traversing the surviving structures would. Report the time per walk, the share of parent to child references
+ * where the child starts within a cache line of the end of its parent and, on Linux if the kernel lets the
+ * process count them, the hardware cache references and misses per walk.
+ */
+int32_t
+GCConfigTest::objectGraphWalk(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t count = OMR_MAX((uintptr_t)node.attribute("count").as_ullong(), 1);
+	uintptr_t stackSize = hashTableGetCount(exampleVM->objectTable) + hashTableGetCount(exampleVM->rootTable) + 1;
+	int32_t rt = 0;
+
+	omrobjectptr_t *stack = (omrobjectptr_t *)omrmem_allocate_memory(stackSize * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == stack) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate the object graph walk stack.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+#if defined(LINUX)
+	int cacheReferenceCounter = openCacheEventCounter(PERF_COUNT_HW_CACHE_REFERENCES);
+	int cacheMissCounter = openCacheEventCounter(PERF_COUNT_HW_CACHE_MISSES);
+	if ((-1 != cacheReferenceCounter) && (-1 != cacheMissCounter)) {
+		ioctl(cacheReferenceCounter, PERF_EVENT_IOC_RESET, 0);
+		ioctl(cacheMissCounter, PERF_EVENT_IOC_RESET, 0);
+		ioctl(cacheReferenceCounter, PERF_EVENT_IOC_ENABLE, 0);
+		ioctl(cacheMissCounter, PERF_EVENT_IOC_ENABLE, 0);
+	}
+#endif /* defined(LINUX) */
+
+	uintptr_t objects = 0;
+	uintptr_t references = 0;
+	uintptr_t adjacentReferences = 0;
+	uintptr_t headerSum = 0;
+	uint64_t startTime = omrtime_hires_clock();
+	for (uintptr_t walk = 0; (0 == rt) && (walk < count); walk++) {
+		J9HashTableState state;
+		RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+		for (; (0 == rt) && (NULL != rootEntry); rootEntry = (RootEntry *)hashTableNextDo(&state)) {
+			uintptr_t top = 0;
+			stack[top++] = rootEntry->rootPtr;
+			while ((0 == rt) && (0 < top)) {
+				omrobjectptr_t objectPtr = stack[--top];
+				headerSum += (uintptr_t)objectPtr->header.raw();
+				objects += 1;
+				uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				uintptr_t objectEnd = (uintptr_t)objectPtr + size;
+				fomrobject_t *firstSlot = (fomrobject_t *)objectPtr + 1;
+				fomrobject_t *currentSlot = (fomrobject_t *)objectEnd;
+				/* push the children last to first, so that they are visited in slot order */
+				while (firstSlot < currentSlot) {
+					currentSlot -= 1;
+					GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
+					omrobjectptr_t childPtr = slotObject.readReferenceFromSlot();
+					if (NULL != childPtr) {
+						if (top == stackSize) {
+							gcTestEnv->log(LEVEL_ERROR, "%s:%d Object graph walk found more objects than the object table holds; the graph is not a tree.\n", __FILE__, __LINE__);
+							rt = 1;
+							break;
+						}
+						stack[top++] = childPtr;
+						references += 1;
+						if (((uintptr_t)childPtr >= objectEnd) && (((uintptr_t)childPtr - objectEnd) < OMRGCTEST_CACHE_LINE_SIZE)) {
+							adjacentReferences += 1;
+						}
+					}
+				}
+			}
+		}
+	}
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	objects /= count;
+	references /= count;
+	adjacentReferences /= count;
+	gcTestEnv->log("Object graph walk: %zu objects, %zu references (%zu%% adjacent to their parent), %llu us per walk (checksum 0x%zx)\n",
+		objects, references, (0 == references) ? 0 : ((adjacentReferences * 100) / references), elapsed / count, headerSum);
+
+#if defined(LINUX)
+	if ((-1 != cacheReferenceCounter) && (-1 != cacheMissCounter)) {
+		uint64_t cacheReferences = 0;
+		uint64_t cacheMisses = 0;
+		ioctl(cacheReferenceCounter, PERF_EVENT_IOC_DISABLE, 0);
+		ioctl(cacheMissCounter, PERF_EVENT_IOC_DISABLE, 0);
+		if ((sizeof(cacheReferences) == read(cacheReferenceCounter, &cacheReferences, sizeof(cacheReferences)))
+			&& (sizeof(cacheMisses) == read(cacheMissCounter, &cacheMisses, sizeof(cacheMisses)))
+		) {
+			uint64_t missRate = (0 == cacheReferences) ? 0 : ((cacheMisses * 1000) / cacheReferences);
+			gcTestEnv->log("Object graph walk: %llu cache references, %llu cache misses per walk (%llu.%llu%% miss rate)\n",
+				cacheReferences / count, cacheMisses / count, missRate / 10, missRate % 10);
+		}
+	} else {
+		gcTestEnv->log("Object graph walk: hardware cache counters are not available.\n");
+	}
+	if (-1 != cacheReferenceCounter) {
+		close(cacheReferenceCounter);
+	}
+	if (-1 != cacheMissCounter) {
+		close(cacheMissCounter);
+	}
+#endif /* defined(LINUX) */
+
+	omrmem_free_memory(stack);
+	return rt;
+}
+
 int32_t
 GCConfigTest::iniXMLStr(const char *configStyle)
 {
@@ -1011,6 +1407,58 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 	return rt;
 }
 
+void
+GCConfigTest::allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSampleEvent *event = (MM_ObjectAllocationSampleEvent *)eventData;
+	GCConfigTest *test = (GCConfigTest *)userData;
+	if ((NULL != event->object) && (event->estimatedBytes >= event->size)) {
+		test->allocationSamples += 1;
+	}
+}
+
+int32_t
+GCConfigTest::verifyAllocationSamples()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	int32_t rt = 0;
+
+	if (extensions->allocationSampling) {
+		uintptr_t recordedSamples = 0;
+		for (uintptr_t sizeClass = 0; sizeClass < ALLOCATION_SAMPLING_SIZE_CLASSES; sizeClass++) {
+			recordedSamples += extensions->allocationSamplingStats._sampleCount[sizeClass];
+		}
+		gcTestEnv->log("Allocation samples: %zu reported, %zu recorded\n", allocationSamples, recordedSamples);
+		if ((0 == allocationSamples) || (allocationSamples != recordedSamples)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation samples reported to the hook (%zu) do not match the histogram (%zu)!\n", __FILE__, __LINE__, allocationSamples, recordedSamples);
+			rt = 1;
+		} else {
+			char dumpFile[MAX_NAME_LENGTH];
+			omrstr_printf(dumpFile, MAX_NAME_LENGTH, "%s.samples", verboseFile);
+			intptr_t fd = omrfile_open(dumpFile, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+			if ((-1 == fd) || (OMR_ERROR_NONE != OMR_GC_DumpAllocationSamples(exampleVM->_omrVMThread, fd))) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to dump the allocation samples to %s!\n", __FILE__, __LINE__, dumpFile);
+				rt = 1;
+			}
+			if (-1 != fd) {
+				if (0 >= omrfile_flength(fd)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sample dump %s is empty!\n", __FILE__, __LINE__, dumpFile);
+					rt = 1;
+				}
+				omrfile_close(fd);
+				if (!gcTestEnv->keepLog) {
+					omrfile_unlink(dumpFile);
+				}
+			}
+		}
+	} else if (OMR_ERROR_NOT_AVAILABLE != OMR_GC_DumpAllocationSamples(exampleVM->_omrVMThread, OMRPORT_TTY_OUT)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation samples dumped with sampling disabled!\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+	return rt;
+}
+
 TEST_P(GCConfigTest, test)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
@@ -1057,6 +1505,7 @@ TEST_P(GCConfigTest, test)
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
 	}
+	ASSERT_EQ(0, verifyAllocationSamples()) << "Failed in allocation sampling verification.";
 }
 
 INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
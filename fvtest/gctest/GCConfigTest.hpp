@@ -87,6 +87,9 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	/* allocation sampling (-Xgc:allocationSampling) */
+	uintptr_t allocationSamples;
+
 	/*
 	 * Function members
 	 */
@@ -110,7 +113,12 @@ protected:
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t incrementalHeapWalk(pugi::xml_node node);
+	int32_t sizeClassAllocation(pugi::xml_node node);
+	int32_t objectGraphWalk(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
+	int32_t verifyAllocationSamples();
+	static void allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
 	 * be moved whenever new entries are added. This complicates the usage of ObjectEntry pointers that
@@ -159,6 +167,7 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocationSamples(0)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
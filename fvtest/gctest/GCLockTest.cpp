@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "gcTestHelpers.hpp"
+
+#include "AtomicOperations.hpp"
+#include "gcspinlock.h"
+
+#define GCLOCK_MAX_THREADS 64
+#define GCLOCK_TEST_THREADS 8
+#define GCLOCK_TEST_ACQUIRES 20000
+#define GCLOCK_BENCHMARK_MILLIS 500
+/* work done inside and outside of the lock, in nops */
+#define GCLOCK_BENCHMARK_HOLD_NOPS 50
+#define GCLOCK_BENCHMARK_THINK_NOPS 200
+
+/* state shared by the threads of one test or benchmark run */
+typedef struct GCLockTestInfo {
+	J9GCSpinlock spinlock;
+	J9GCQueuedLock queuedLock;
+	bool queued;
+	omrthread_monitor_t startMonitor;
+	volatile bool started;
+	volatile bool stopped;
+	uintptr_t acquiresPerThread;
+	volatile uintptr_t nextThreadIndex;
+	/* updated while holding the lock */
+	uintptr_t counter;
+	uintptr_t lastOwner;
+	uint64_t releaseTime;
+	uint64_t handoffTime;
+	uintptr_t handoffs;
+	uintptr_t acquires[GCLOCK_MAX_THREADS];
+} GCLockTestInfo;
+
+static void
+initLocks(GCLockTestInfo *info, bool queued, uintptr_t spinCount1, uintptr_t spinCount2, uintptr_t spinCount3)
+{
+	memset(info, 0, sizeof(*info));
+	info->queued = queued;
+	info->lastOwner = UDATA_MAX;
+	if (queued) {
+		ASSERT_EQ(0, omrgc_queuedlock_init(&info->queuedLock));
+		info->queuedLock.spinCount1 = spinCount1;
+		info->queuedLock.spinCount2 = spinCount2;
+		info->queuedLock.spinCount3 = spinCount3;
+	} else {
+		ASSERT_EQ(0, omrgc_spinlock_init(&info->spinlock));
+		info->spinlock.spinCount1 = spinCount1;
+		info->spinlock.spinCount2 = spinCount2;
+		info->spinlock.spinCount3 = spinCount3;
+	}
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info->startMonitor, 0, "GC lock test start"));
+}
+
+static void
+destroyLocks(GCLockTestInfo *info)
+{
+	if (info->queued) {
+		omrgc_queuedlock_destroy(&info->queuedLock);
+	} else {
+		omrgc_spinlock_destroy(&info->spinlock);
+	}
+	omrthread_monitor_destroy(info->startMonitor);
+}
+
+static void
+acquire(GCLockTestInfo *info)
+{
+	if (info->queued) {
+		omrgc_queuedlock_acquire(&info->queuedLock, NULL);
+	} else {
+		omrgc_spinlock_acquire(&info->spinlock, NULL);
+	}
+}
+
+static void
+release(GCLockTestInfo *info)
+{
+	if (info->queued) {
+		omrgc_queuedlock_release(&info->queuedLock);
+	} else {
+		omrgc_spinlock_release(&info->spinlock);
+	}
+}
+
+static void
+spin(uintptr_t nops)
+{
+	for (uintptr_t i = 0; i < nops; i++) {
+		MM_AtomicOperations::nop();
+	}
+}
+
+static void
+waitForStart(GCLockTestInfo *info)
+{
+	omrthread_monitor_enter(info->startMonitor);
+	while (!info->started) {
+		omrthread_monitor_wait(info->startMonitor);
+	}
+	omrthread_monitor_exit(info->startMonitor);
+}
+
+static int J9THREAD_PROC
+incrementCounter(void *entryArg)
+{
+	GCLockTestInfo *info = (GCLockTestInfo *)entryArg;
+
+	waitForStart(info);
+	for (uintptr_t i = 0; i < info->acquiresPerThread; i++) {
+		acquire(info);
+		info->counter += 1;
+		release(info);
+	}
+	return 0;
+}
+
+/**
+ * Acquire the lock until stopped, timing each handoff from the release by one thread
+ * to the acquire by another.
+ */
+static int J9THREAD_PROC
+measureHandoffs(void *entryArg)
+{
+	GCLockTestInfo *info = (GCLockTestInfo *)entryArg;
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t threadIndex = MM_AtomicOperations::add(&info->nextThreadIndex, 1) - 1;
+
+	waitForStart(info);
+	while (!info->stopped) {
+		acquire(info);
+		uint64_t now = omrtime_hires_clock();
+		if ((threadIndex != info->lastOwner) && (0 != info->releaseTime)) {
+			info->handoffTime += now - info->releaseTime;
+			info->handoffs += 1;
+		}
+		info->acquires[threadIndex] += 1;
+		info->counter += 1;
+		spin(GCLOCK_BENCHMARK_HOLD_NOPS);
+		info->lastOwner = threadIndex;
+		info->releaseTime = omrtime_hires_clock();
+		release(info);
+		spin(GCLOCK_BENCHMARK_THINK_NOPS);
+	}
+	return 0;
+}
+
+/**
+ * Start threadCount threads running entrypoint, stop them after millis milliseconds if non-zero, and join them.
+ */
+static void
+runThreads(GCLockTestInfo *info, omrthread_entrypoint_t entrypoint, uintptr_t threadCount, uintptr_t millis)
+{
+	omrthread_t threads[GCLOCK_MAX_THREADS];
+	omrthread_attr_t attr = NULL;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, FALSE, entrypoint, info));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+	omrthread_monitor_enter(info->startMonitor);
+	info->started = true;
+	omrthread_monitor_notify_all(info->startMonitor);
+	omrthread_monitor_exit(info->startMonitor);
+	if (0 != millis) {
+		omrthread_sleep(millis);
+		info->stopped = true;
+	}
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+}
+
+TEST(gcFunctionalTestQueuedLock, mutualExclusion)
+{
+	GCLockTestInfo info;
+
+	initLocks(&info, true, 256, 32, 45);
+	info.acquiresPerThread = GCLOCK_TEST_ACQUIRES;
+	runThreads(&info, incrementCounter, GCLOCK_TEST_THREADS, 0);
+	ASSERT_EQ((uintptr_t)(GCLOCK_TEST_THREADS * GCLOCK_TEST_ACQUIRES), info.counter);
+	ASSERT_TRUE(NULL == info.queuedLock.tail);
+	ASSERT_TRUE(NULL == info.queuedLock.head.next);
+	destroyLocks(&info);
+}
+
+TEST(gcFunctionalTestQueuedLock, blockedWaiters)
+{
+	GCLockTestInfo info;
+
+	/* no spinning: contended acquires go straight to blocking */
+	initLocks(&info, true, 0, 1, 1);
+	info.acquiresPerThread = GCLOCK_TEST_ACQUIRES / 10;
+	runThreads(&info, incrementCounter, GCLOCK_TEST_THREADS, 0);
+	ASSERT_EQ((uintptr_t)(GCLOCK_TEST_THREADS * (GCLOCK_TEST_ACQUIRES / 10)), info.counter);
+	ASSERT_TRUE(NULL == info.queuedLock.tail);
+	destroyLocks(&info);
+}
+
+/**
+ * Compare the test-and-set spinlock with the queued lock at 8, 32 and 64 threads: average handoff
+ * latency from one thread's release to another thread's acquire, throughput, and fairness as
+ * Jain's index over the per-thread acquire counts (1 when all threads acquired equally often).
+ */
+TEST(perfTestGCLock, handoffLatencyAndFairness)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const uintptr_t threadCounts[] = {8, 32, 64};
+	const char *lockNames[] = {"spinlock", "queued"};
+
+	for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+		uintptr_t threadCount = threadCounts[t];
+		for (uintptr_t mode = 0; mode < 2; mode++) {
+			GCLockTestInfo info;
+
+			/* the default lnrlOptions spin counts */
+			initLocks(&info, 1 == mode, 256, 32, 45);
+			runThreads(&info, measureHandoffs, threadCount, GCLOCK_BENCHMARK_MILLIS);
+
+			double sum = 0.0;
+			double sumOfSquares = 0.0;
+			uintptr_t minAcquires = UDATA_MAX;
+			uintptr_t maxAcquires = 0;
+			for (uintptr_t i = 0; i < threadCount; i++) {
+				sum += (double)info.acquires[i];
+				sumOfSquares += (double)info.acquires[i] * (double)info.acquires[i];
+				minAcquires = OMR_MIN(minAcquires, info.acquires[i]);
+				maxAcquires = OMR_MAX(maxAcquires, info.acquires[i]);
+			}
+			ASSERT_EQ((uintptr_t)sum, info.counter);
+			double fairness = (0.0 == sumOfSquares) ? 0.0 : (sum * sum) / ((double)threadCount * sumOfSquares);
+			uint64_t handoffNanos = 0;
+			if (0 != info.handoffs) {
+				handoffNanos = omrtime_hires_delta(0, info.handoffTime, OMRPORT_TIME_DELTA_IN_NANOSECONDS) / info.handoffs;
+			}
+			gcTestEnv->log("%2zu threads, %-8s: %8zu acquires, %7zu handoffs, %8llu ns/handoff, fairness %.3f, acquires per thread %zu..%zu\n",
+				(size_t)threadCount, lockNames[mode], (size_t)info.counter, (size_t)info.handoffs, (unsigned long long)handoffNanos,
+				fairness, (size_t)minAcquires, (size_t)maxAcquires);
+			destroyLocks(&info);
+		}
+	}
+}
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "gcTestHelpers.hpp"
+
+#include "HeapMapScanner.hpp"
+
+#define HEAPMAP_TEST_SLOTS 1024
+#define HEAPMAP_BENCHMARK_SLOTS (1024 * 1024)
+#define HEAPMAP_BENCHMARK_ITERATIONS 20
+
+/**
+ * Walk a heap map the way MM_ParallelSweepScheme::sweepChunk() does: skip each run of empty words in one call
+ * and step over each non-empty word.
+ * @return the number of empty runs found
+ */
+static uintptr_t
+sweepHeapMap(uintptr_t *heapMapBase, uintptr_t *heapMapTop, bool useBlockScan)
+{
+	uintptr_t freeRuns = 0;
+	uintptr_t *heapMapCurrent = heapMapBase;
+	while (heapMapCurrent < heapMapTop) {
+		if (0 == *heapMapCurrent) {
+			if (useBlockScan) {
+				heapMapCurrent = MM_HeapMapScanner::skipEmptySlots(heapMapCurrent + 1, heapMapTop);
+			} else {
+				heapMapCurrent = MM_HeapMapScanner::skipEmptySlotsScalar(heapMapCurrent + 1, heapMapTop);
+			}
+			freeRuns += 1;
+		} else {
+			heapMapCurrent += 1;
+		}
+	}
+	return freeRuns;
+}
+
+/**
+ * Fill the heap map so that roughly one word in every liveWordInterval words is non-empty.
+ */
+static void
+fillHeapMap(uintptr_t *heapMap, uintptr_t slots, uintptr_t liveWordInterval)
+{
+	uint32_t seed = 0x9E3779B9;
+	for (uintptr_t i = 0; i < slots; i++) {
+		seed = (seed * 1103515245) + 12345;
+		heapMap[i] = (0 == ((seed >> 8) % liveWordInterval)) ? ((uintptr_t)1 << ((seed >> 3) % (sizeof(uintptr_t) * 8))) : 0;
+	}
+}
+
+TEST(gcFunctionalTestHeapMapScanner, matchesScalarScan)
+{
+	uintptr_t heapMap[HEAPMAP_TEST_SLOTS];
+
+	for (uintptr_t start = 0; start < 8; start++) {
+		for (uintptr_t live = start; live <= HEAPMAP_TEST_SLOTS; live++) {
+			memset(heapMap, 0, sizeof(heapMap));
+			if (live < HEAPMAP_TEST_SLOTS) {
+				heapMap[live] = (uintptr_t)1 << (live % (sizeof(uintptr_t) * 8));
+			}
+			uintptr_t *expected = MM_HeapMapScanner::skipEmptySlotsScalar(heapMap + start, heapMap + HEAPMAP_TEST_SLOTS);
+			ASSERT_EQ(heapMap + live, expected);
+			ASSERT_EQ(expected, MM_HeapMapScanner::skipEmptySlots(heapMap + start, heapMap + HEAPMAP_TEST_SLOTS));
+		}
+	}
+
+	for (uintptr_t interval = 1; interval <= 64; interval *= 2) {
+		fillHeapMap(heapMap, HEAPMAP_TEST_SLOTS, interval);
+		ASSERT_EQ(sweepHeapMap(heapMap, heapMap + HEAPMAP_TEST_SLOTS, false), sweepHeapMap(heapMap, heapMap + HEAPMAP_TEST_SLOTS, true));
+	}
+}
+
+TEST(perfTestHeapMapScanner, sweepSyntheticMarkMaps)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const uintptr_t liveWordIntervals[] = {2, 8, 64, 512, 4096};
+
+	uintptr_t *heapMap = (uintptr_t *)omrmem_allocate_memory(HEAPMAP_BENCHMARK_SLOTS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != heapMap);
+
+	for (uintptr_t i = 0; i < sizeof(liveWordIntervals) / sizeof(liveWordIntervals[0]); i++) {
+		fillHeapMap(heapMap, HEAPMAP_BENCHMARK_SLOTS, liveWordIntervals[i]);
+		uint64_t elapsed[2] = {0, 0};
+		uintptr_t freeRuns[2] = {0, 0};
+		for (uintptr_t mode = 0; mode < 2; mode++) {
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t iteration = 0; iteration < HEAPMAP_BENCHMARK_ITERATIONS; iteration++) {
+				freeRuns[mode] = sweepHeapMap(heapMap, heapMap + HEAPMAP_BENCHMARK_SLOTS, (1 == mode));
+			}
+			elapsed[mode] = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		}
+		ASSERT_EQ(freeRuns[0], freeRuns[1]);
+		gcTestEnv->log("1/%zu live mark map words: %zu free runs, scalar %llu us, block scan %llu us\n",
+			(size_t)liveWordIntervals[i], (size_t)freeRuns[0], (unsigned long long)elapsed[0], (unsigned long long)elapsed[1]);
+	}
+
+	omrmem_free_memory(heapMap);
+}
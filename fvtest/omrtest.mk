@@ -90,10 +90,10 @@ omr_sigtest:
 	./omrsigtest
 
 omr_threadextendedtest:
-	./omrthreadextendedtest
+	./omrthreadextendedtest --gtest_filter=-*PerfTest.*
 
 omr_threadtest:
-	./omrthreadtest
+	./omrthreadtest --gtest_filter=-*PerfTest.*
 	./omrthreadtest --gtest_also_run_disabled_tests --gtest_filter=ThreadCreateTest.DISABLED_SetAttrThreadWeight
 ifneq (,$(findstring linux,$(SPEC)))
 	./omrthreadtest --gtest_filter=ThreadCreateTest.*:$(GTEST_FILTER) -realtime
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadExtendedTestHelpers.hpp"
+
+#define CPU_TIMES_MAX_THREADS 256
+#define CPU_TIMES_TEST_THREADS 8
+/* number of CPU times read per configuration of the benchmark */
+#define CPU_TIMES_BENCHMARK_READS 200000
+
+/* a set of threads parked until released */
+typedef struct CpuTimesThreads {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t started;
+	volatile BOOLEAN released;
+	uintptr_t count;
+	omrthread_t threads[CPU_TIMES_MAX_THREADS];
+} CpuTimesThreads;
+
+static int J9THREAD_PROC
+waitForRelease(void *arg)
+{
+	CpuTimesThreads *info = (CpuTimesThreads *)arg;
+
+	omrthread_monitor_enter(info->monitor);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->monitor);
+	while (!info->released) {
+		omrthread_monitor_wait(info->monitor);
+	}
+	omrthread_monitor_exit(info->monitor);
+	return 0;
+}
+
+static void
+startThreads(CpuTimesThreads *info, uintptr_t count)
+{
+	omrthread_attr_t attr = NULL;
+
+	memset(info, 0, sizeof(*info));
+	info->count = count;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info->monitor, 0, "cpu times threads"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t i = 0; i < count; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&info->threads[i], &attr, FALSE, waitForRelease, info));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+	omrthread_monitor_enter(info->monitor);
+	while (info->started < count) {
+		omrthread_monitor_wait(info->monitor);
+	}
+	omrthread_monitor_exit(info->monitor);
+}
+
+static void
+stopThreads(CpuTimesThreads *info)
+{
+	omrthread_monitor_enter(info->monitor);
+	info->released = TRUE;
+	omrthread_monitor_notify_all(info->monitor);
+	omrthread_monitor_exit(info->monitor);
+	for (uintptr_t i = 0; i < info->count; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(info->threads[i]));
+	}
+	omrthread_monitor_destroy(info->monitor);
+}
+
+/**
+ * omrthread_get_cpu_times returns the same times as omrthread_get_cpu_time_ex for each thread.
+ */
+TEST(ThreadExtendedTest, TestCpuTimesBatch)
+{
+	CpuTimesThreads info;
+	omrthread_t threads[CPU_TIMES_TEST_THREADS + 1];
+	int64_t cpuTimes[CPU_TIMES_TEST_THREADS + 1];
+
+	startThreads(&info, CPU_TIMES_TEST_THREADS);
+	for (uintptr_t i = 0; i < CPU_TIMES_TEST_THREADS; i++) {
+		threads[i] = info.threads[i];
+	}
+	threads[CPU_TIMES_TEST_THREADS] = omrthread_self();
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_get_cpu_times(threads, 0, cpuTimes));
+	intptr_t rc = omrthread_get_cpu_times(threads, CPU_TIMES_TEST_THREADS + 1, cpuTimes);
+	if (J9THREAD_ERR == rc) {
+		/* not supported on this platform */
+		ASSERT_EQ(-1, omrthread_get_cpu_time(omrthread_self()));
+	} else {
+		ASSERT_EQ(J9THREAD_SUCCESS, rc);
+		for (uintptr_t i = 0; i <= CPU_TIMES_TEST_THREADS; i++) {
+			int64_t cpuTime = 0;
+			ASSERT_LE(0, cpuTimes[i]);
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_get_cpu_time_ex(threads[i], &cpuTime));
+			ASSERT_LE(cpuTimes[i], cpuTime);
+		}
+	}
+	stopThreads(&info);
+}
+
+/**
+ * Compare the cost per thread of reading the CPU times of 1 to 256 threads one call at a
+ * time with reading them in a single omrthread_get_cpu_times call. Use -logLevel=verbose
+ * to see the results.
+ */
+TEST(ThreadCpuTimePerfTest, BatchVersusPerThread)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	static const uintptr_t threadCounts[] = {1, 4, 16, 64, 256};
+	static int64_t cpuTimes[CPU_TIMES_MAX_THREADS];
+
+	for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+		CpuTimesThreads info;
+		uintptr_t threadCount = threadCounts[t];
+		uintptr_t iterations = CPU_TIMES_BENCHMARK_READS / threadCount;
+
+		startThreads(&info, threadCount);
+
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t iteration = 0; iteration < iterations; iteration++) {
+			for (uintptr_t i = 0; i < threadCount; i++) {
+				EXPECT_EQ(J9THREAD_SUCCESS, omrthread_get_cpu_time_ex(info.threads[i], &cpuTimes[i]));
+			}
+		}
+		uint64_t perThreadTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+		startTime = omrtime_hires_clock();
+		for (uintptr_t iteration = 0; iteration < iterations; iteration++) {
+			EXPECT_EQ(J9THREAD_SUCCESS, omrthread_get_cpu_times(info.threads, threadCount, cpuTimes));
+		}
+		uint64_t batchTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+		omrTestEnv->log(LEVEL_VERBOSE, "%3zu threads: per-thread calls %6llu ns/call, %5llu ns/thread; batch %6llu ns/call, %5llu ns/thread\n",
+			threadCount,
+			perThreadTime / iterations, perThreadTime / (iterations * threadCount),
+			batchTime / iterations, batchTime / (iterations * threadCount));
+		stopThreads(&info);
+	}
+}
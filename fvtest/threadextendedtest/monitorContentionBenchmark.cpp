@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadExtendedTestHelpers.hpp"
+
+#define BENCHMARK_MAX_THREADS 32
+#define BENCHMARK_ENTERS 200000
+#define BENCHMARK_MIN_ENTERS_PER_THREAD 2000
+#define BENCHMARK_HANDOFFS 2000
+
+/* state shared by the threads of one benchmark run */
+typedef struct MonitorBenchmarkInfo {
+	omrthread_monitor_t monitor;
+	omrthread_monitor_t startMonitor;
+	volatile BOOLEAN started;
+	uintptr_t entersPerThread;
+	uintptr_t threadCount;
+	volatile uintptr_t counter;
+	volatile uintptr_t generation;
+	volatile uintptr_t arrived;
+} MonitorBenchmarkInfo;
+
+static void
+waitForStart(MonitorBenchmarkInfo *info)
+{
+	omrthread_monitor_enter(info->startMonitor);
+	while (!info->started) {
+		omrthread_monitor_wait(info->startMonitor);
+	}
+	omrthread_monitor_exit(info->startMonitor);
+}
+
+/**
+ * Enter and exit the monitor for the configured number of short critical sections.
+ */
+static int J9THREAD_PROC
+runEnters(void *arg)
+{
+	MonitorBenchmarkInfo *info = (MonitorBenchmarkInfo *)arg;
+
+	waitForStart(info);
+	for (uintptr_t i = 0; i < info->entersPerThread; i++) {
+		omrthread_monitor_enter(info->monitor);
+		info->counter += 1;
+		omrthread_monitor_exit(info->monitor);
+	}
+	return 0;
+}
+
+/**
+ * Meet the other threads at a barrier built on wait/notify_all, BENCHMARK_HANDOFFS times;
+ * the last thread to arrive wakes all the others.
+ */
+static int J9THREAD_PROC
+runBarriers(void *arg)
+{
+	MonitorBenchmarkInfo *info = (MonitorBenchmarkInfo *)arg;
+
+	waitForStart(info);
+	omrthread_monitor_enter(info->monitor);
+	for (uintptr_t i = 0; i < BENCHMARK_HANDOFFS; i++) {
+		uintptr_t generation = info->generation;
+
+		info->arrived += 1;
+		if (info->arrived == info->threadCount) {
+			info->arrived = 0;
+			info->generation += 1;
+			info->counter += 1;
+			omrthread_monitor_notify_all(info->monitor);
+		} else {
+			while (generation == info->generation) {
+				omrthread_monitor_wait(info->monitor);
+			}
+		}
+	}
+	omrthread_monitor_exit(info->monitor);
+	return 0;
+}
+
+/**
+ * Run one configuration and return the elapsed time in microseconds.
+ */
+static uint64_t
+runBenchmark(uintptr_t monitorFlags, omrthread_entrypoint_t entrypoint, uintptr_t threadCount, uintptr_t *counter)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	MonitorBenchmarkInfo info;
+	omrthread_t threads[BENCHMARK_MAX_THREADS];
+	omrthread_attr_t attr = NULL;
+
+	memset(&info, 0, sizeof(info));
+	info.threadCount = threadCount;
+	info.entersPerThread = OMR_MAX(BENCHMARK_ENTERS / threadCount, BENCHMARK_MIN_ENTERS_PER_THREAD);
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, monitorFlags, "monitor benchmark"));
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&info.startMonitor, 0, "monitor benchmark start"));
+
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, FALSE, entrypoint, &info));
+	}
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+	uint64_t startTime = omrtime_hires_clock();
+	omrthread_monitor_enter(info.startMonitor);
+	info.started = TRUE;
+	omrthread_monitor_notify_all(info.startMonitor);
+	omrthread_monitor_exit(info.startMonitor);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	*counter = info.counter;
+	omrthread_monitor_destroy(info.startMonitor);
+	omrthread_monitor_destroy(info.monitor);
+	return OMR_MAX(elapsed, 1);
+}
+
+/**
+ * Compare the enter/exit throughput of monitors using the default backend and the futex
+ * backend for 1 to 32 threads. Use -logLevel=verbose to see the results.
+ */
+TEST(MonitorPerfTest, ContendedEnterExit)
+{
+	static const uintptr_t threadCounts[] = {1, 2, 4, 8, 16, 32};
+
+	for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+		uintptr_t threadCount = threadCounts[t];
+		uintptr_t enters = threadCount * OMR_MAX(BENCHMARK_ENTERS / threadCount, BENCHMARK_MIN_ENTERS_PER_THREAD);
+		uintptr_t counter = 0;
+		uint64_t defaultTime = runBenchmark(0, runEnters, threadCount, &counter);
+		EXPECT_EQ(enters, counter) << "default monitor lost an update";
+		uint64_t futexTime = runBenchmark(J9THREAD_MONITOR_FUTEX, runEnters, threadCount, &counter);
+		EXPECT_EQ(enters, counter) << "futex monitor lost an update";
+		omrTestEnv->log(LEVEL_VERBOSE, "%2zu threads: default %6llu ns/enter, futex %6llu ns/enter\n",
+			threadCount, (defaultTime * 1000) / enters, (futexTime * 1000) / enters);
+	}
+}
+
+/**
+ * Compare the cost of a notify_all barrier of 2 to 32 threads on monitors using the default
+ * backend and the futex backend. Use -logLevel=verbose to see the results.
+ */
+TEST(MonitorPerfTest, NotifyAllBarrier)
+{
+	static const uintptr_t threadCounts[] = {2, 4, 8, 16, 32};
+
+	for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+		uintptr_t threadCount = threadCounts[t];
+		uintptr_t counter = 0;
+		uint64_t defaultTime = runBenchmark(0, runBarriers, threadCount, &counter);
+		EXPECT_EQ((uintptr_t)BENCHMARK_HANDOFFS, counter) << "default monitor lost a barrier";
+		uint64_t futexTime = runBenchmark(J9THREAD_MONITOR_FUTEX, runBarriers, threadCount, &counter);
+		EXPECT_EQ((uintptr_t)BENCHMARK_HANDOFFS, counter) << "futex monitor lost a barrier";
+		omrTestEnv->log(LEVEL_VERBOSE, "%2zu threads: default %6llu ns/barrier, futex %6llu ns/barrier\n",
+			threadCount, (defaultTime * 1000) / BENCHMARK_HANDOFFS, (futexTime * 1000) / BENCHMARK_HANDOFFS);
+	}
+}
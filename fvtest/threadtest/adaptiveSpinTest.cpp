@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "threadTestLib.hpp"
+
+#define CONTENDED_ROUNDS 40
+#define CONTENDERS_PER_ROUND 3
+#define UNCONTENDED_ENTERS 2000
+
+TEST(AdaptiveSpinTest, getSpinCounts)
+{
+	omrthread_monitor_t monitor = NULL;
+	uintptr_t spinCount1 = 0;
+	uintptr_t spinCount2 = 0;
+	uintptr_t spinCount3 = 0;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "getSpinCounts"));
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	omrthread_library_t lib = omrthread_self()->library;
+
+	ASSERT_EQ(0, omrthread_monitor_get_spin_counts(monitor, &spinCount1, &spinCount2, &spinCount3));
+	ASSERT_EQ(lib->defaultMonitorSpinCount1, spinCount1);
+	ASSERT_EQ(lib->defaultMonitorSpinCount2, spinCount2);
+	ASSERT_EQ(lib->defaultMonitorSpinCount3, spinCount3);
+#else /* OMR_THR_THREE_TIER_LOCKING */
+	ASSERT_EQ(-1, omrthread_monitor_get_spin_counts(monitor, &spinCount1, &spinCount2, &spinCount3));
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+}
+
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+static int J9THREAD_PROC
+enterExitHelper(void *entryArg)
+{
+	omrthread_monitor_t monitor = (omrthread_monitor_t)entryArg;
+
+	omrthread_monitor_enter(monitor);
+	omrthread_monitor_exit(monitor);
+	return 0;
+}
+
+/**
+ * A monitor whose enters mostly block drops to shorter spin tiers, then stops spinning; once its
+ * enters stop blocking it returns to the default spin counts and beyond.
+ */
+TEST(AdaptiveSpinTest, spinTiersFollowSlowEnters)
+{
+	omrthread_library_t lib = omrthread_self()->library;
+	uintptr_t adaptiveFlags = J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TIERS_ENABLED | J9THREAD_LIB_FLAG_JLM_INFO_SAMPLING_ENABLED;
+	uintptr_t flagsToClear = adaptiveFlags & ~omrthread_lib_get_flags();
+	omrthread_monitor_t monitor = NULL;
+	J9ThreadMonitorTracing *tracing = NULL;
+	uintptr_t spinCount1 = 0;
+	uintptr_t spinCount2 = 0;
+	uintptr_t spinCount3 = 0;
+	intptr_t highestTier = 0;
+
+	*(uintptr_t *)omrthread_global((char *)"adaptSpinTiersEnable") = 1;
+	ASSERT_EQ(0, jlm_adaptive_spin_init());
+	*(uintptr_t *)omrthread_global((char *)"adaptSpinTiersEnable") = 0;
+	ASSERT_EQ(adaptiveFlags, omrthread_lib_get_flags() & adaptiveFlags);
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "spinTiersFollowSlowEnters"));
+	tracing = omrthread_monitor_get_tracing(monitor);
+	ASSERT_TRUE(NULL != tracing);
+
+	/* hold the monitor long enough for the contenders to give up spinning and block */
+	for (uintptr_t round = 0; round < CONTENDED_ROUNDS; round++) {
+		omrthread_t contenders[CONTENDERS_PER_ROUND];
+		omrthread_attr_t attr = NULL;
+
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		omrthread_monitor_enter(monitor);
+		for (uintptr_t i = 0; i < CONTENDERS_PER_ROUND; i++) {
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&contenders[i], &attr, FALSE, enterExitHelper, monitor));
+		}
+		omrthread_sleep(5);
+		omrthread_monitor_exit(monitor);
+		for (uintptr_t i = 0; i < CONTENDERS_PER_ROUND; i++) {
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(contenders[i]));
+		}
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+		highestTier = OMR_MAX(highestTier, tracing->spin_tier);
+	}
+	ASSERT_LT(0, highestTier) << "blocking enters did not shrink the spin tiers";
+	ASSERT_EQ(0, omrthread_monitor_get_spin_counts(monitor, &spinCount1, &spinCount2, &spinCount3));
+	if (tracing->spin_tier > ADAPT_SPIN_TIERS_MAX_SHRINK) {
+		ASSERT_TRUE(0 != (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING));
+		ASSERT_EQ((uintptr_t)1, spinCount2);
+		ASSERT_EQ((uintptr_t)1, spinCount3);
+	} else if (tracing->spin_tier > 0) {
+		ASSERT_GT(lib->defaultMonitorSpinCount2, spinCount2);
+	}
+
+	for (uintptr_t i = 0; i < UNCONTENDED_ENTERS; i++) {
+		omrthread_monitor_enter(monitor);
+		omrthread_monitor_exit(monitor);
+	}
+	ASSERT_EQ(-ADAPT_SPIN_TIERS_MAX_GROW, tracing->spin_tier) << "uncontended enters did not grow the spin tiers";
+	ASSERT_TRUE(0 == (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING));
+	ASSERT_EQ(0, omrthread_monitor_get_spin_counts(monitor, &spinCount1, &spinCount2, &spinCount3));
+	ASSERT_EQ(lib->defaultMonitorSpinCount1, spinCount1);
+	ASSERT_EQ(lib->defaultMonitorSpinCount2 << ADAPT_SPIN_TIERS_MAX_GROW, spinCount2);
+	ASSERT_EQ(lib->defaultMonitorSpinCount3 << ADAPT_SPIN_TIERS_MAX_GROW, spinCount3);
+
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+	omrthread_lib_clear_flags(flagsToClear);
+}
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
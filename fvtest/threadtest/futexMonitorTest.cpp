@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadTestHelp.h"
+#include "thrtypes.h"
+
+#define FUTEX_TEST_THREADS 8
+#define FUTEX_TEST_ENTERS 20000
+
+/* state shared by the threads of one test */
+typedef struct FutexMonitorTestInfo {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t counter;
+	volatile uintptr_t waiters;
+	volatile uintptr_t woken;
+	volatile BOOLEAN released;
+	volatile intptr_t rc;
+} FutexMonitorTestInfo;
+
+TEST(FutexMonitorTest, flagMatchesPlatform)
+{
+	omrthread_monitor_t monitor = NULL;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, J9THREAD_MONITOR_FUTEX, "flagMatchesPlatform"));
+#if defined(OMR_THR_FUTEX_MONITORS)
+	ASSERT_TRUE(0 != (monitor->flags & J9THREAD_MONITOR_FUTEX));
+#else /* OMR_THR_FUTEX_MONITORS */
+	ASSERT_TRUE(0 == (monitor->flags & J9THREAD_MONITOR_FUTEX));
+#endif /* OMR_THR_FUTEX_MONITORS */
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+}
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+static void
+initInfo(FutexMonitorTestInfo *info, const char *name)
+{
+	memset(info, 0, sizeof(*info));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info->monitor, J9THREAD_MONITOR_FUTEX, name));
+}
+
+/* Block until count threads are waiting on the monitor. Returns owning the monitor. */
+static void
+enterWhenWaiting(FutexMonitorTestInfo *info, uintptr_t count)
+{
+	omrthread_monitor_enter(info->monitor);
+	while (info->waiters < count) {
+		omrthread_monitor_exit(info->monitor);
+		omrthread_sleep(1);
+		omrthread_monitor_enter(info->monitor);
+	}
+}
+
+static int J9THREAD_PROC
+incrementCounter(void *entryArg)
+{
+	FutexMonitorTestInfo *info = (FutexMonitorTestInfo *)entryArg;
+
+	for (uintptr_t i = 0; i < FUTEX_TEST_ENTERS; i++) {
+		omrthread_monitor_enter(info->monitor);
+		info->counter += 1;
+		omrthread_monitor_exit(info->monitor);
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+waitUntilReleased(void *entryArg)
+{
+	FutexMonitorTestInfo *info = (FutexMonitorTestInfo *)entryArg;
+
+	omrthread_monitor_enter(info->monitor);
+	info->waiters += 1;
+	while (!info->released) {
+		omrthread_monitor_wait(info->monitor);
+	}
+	info->woken += 1;
+	omrthread_monitor_exit(info->monitor);
+	return 0;
+}
+
+static int J9THREAD_PROC
+waitInterruptable(void *entryArg)
+{
+	FutexMonitorTestInfo *info = (FutexMonitorTestInfo *)entryArg;
+
+	omrthread_monitor_enter(info->monitor);
+	info->waiters += 1;
+	info->rc = omrthread_monitor_wait_interruptable(info->monitor, 0, 0);
+	info->woken += 1;
+	omrthread_monitor_exit(info->monitor);
+	return 0;
+}
+
+static int J9THREAD_PROC
+enterAbortable(void *entryArg)
+{
+	FutexMonitorTestInfo *info = (FutexMonitorTestInfo *)entryArg;
+
+	info->rc = omrthread_monitor_enter_abortable_using_threadId(info->monitor, omrthread_self());
+	if (0 == info->rc) {
+		omrthread_monitor_exit(info->monitor);
+	}
+	return 0;
+}
+
+TEST(FutexMonitorTest, contendedEnterExit)
+{
+	FutexMonitorTestInfo info;
+	omrthread_t threads[FUTEX_TEST_THREADS];
+
+	initInfo(&info, "contendedEnterExit");
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		createJoinableThread(&threads[i], incrementCounter, &info);
+	}
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	ASSERT_EQ((uintptr_t)(FUTEX_TEST_THREADS * FUTEX_TEST_ENTERS), info.counter);
+	ASSERT_EQ((uintptr_t)J9THREAD_MONITOR_SPINLOCK_UNOWNED, info.monitor->spinlockState);
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+
+TEST(FutexMonitorTest, notifyWakesOneWaiter)
+{
+	FutexMonitorTestInfo info;
+	omrthread_t threads[2];
+
+	initInfo(&info, "notifyWakesOneWaiter");
+	for (uintptr_t i = 0; i < 2; i++) {
+		createJoinableThread(&threads[i], waitUntilReleased, &info);
+	}
+	enterWhenWaiting(&info, 2);
+	info.released = TRUE;
+	ASSERT_EQ(0, omrthread_monitor_notify(info.monitor));
+	omrthread_monitor_exit(info.monitor);
+
+	/* only the notified thread can leave its wait */
+	omrthread_sleep(100);
+	omrthread_monitor_enter(info.monitor);
+	ASSERT_EQ((uintptr_t)1, info.woken);
+	ASSERT_EQ((uintptr_t)1, omrthread_monitor_num_waiting(info.monitor));
+	ASSERT_EQ(0, omrthread_monitor_notify_all(info.monitor));
+	omrthread_monitor_exit(info.monitor);
+
+	for (uintptr_t i = 0; i < 2; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	ASSERT_EQ((uintptr_t)2, info.woken);
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+
+TEST(FutexMonitorTest, notifyAllWakesAllWaiters)
+{
+	FutexMonitorTestInfo info;
+	omrthread_t threads[FUTEX_TEST_THREADS];
+
+	initInfo(&info, "notifyAllWakesAllWaiters");
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		createJoinableThread(&threads[i], waitUntilReleased, &info);
+	}
+	enterWhenWaiting(&info, FUTEX_TEST_THREADS);
+	info.released = TRUE;
+	ASSERT_EQ(0, omrthread_monitor_notify_all(info.monitor));
+	/* the notified threads are requeued on the monitor, none of them can run before it's released */
+	ASSERT_EQ((uintptr_t)0, omrthread_monitor_num_waiting(info.monitor));
+	ASSERT_EQ((uintptr_t)0, info.woken);
+	omrthread_monitor_exit(info.monitor);
+
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_THREADS, info.woken);
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+
+TEST(FutexMonitorTest, timedWaitTimesOut)
+{
+	FutexMonitorTestInfo info;
+
+	initInfo(&info, "timedWaitTimesOut");
+	omrthread_monitor_enter(info.monitor);
+	ASSERT_EQ(J9THREAD_TIMED_OUT, omrthread_monitor_wait_timed(info.monitor, 10, 0));
+	ASSERT_EQ((uintptr_t)0, omrthread_monitor_num_waiting(info.monitor));
+	ASSERT_TRUE(omrthread_self() == info.monitor->owner);
+	omrthread_monitor_exit(info.monitor);
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+
+TEST(FutexMonitorTest, interruptWakesWaiter)
+{
+	FutexMonitorTestInfo info;
+	omrthread_t thread = NULL;
+
+	initInfo(&info, "interruptWakesWaiter");
+	createJoinableThread(&thread, waitInterruptable, &info);
+	enterWhenWaiting(&info, 1);
+	omrthread_monitor_exit(info.monitor);
+	omrthread_interrupt(thread);
+	VERBOSE_JOIN(thread, J9THREAD_SUCCESS);
+	ASSERT_EQ(J9THREAD_INTERRUPTED, info.rc);
+	ASSERT_EQ((uintptr_t)0, omrthread_monitor_num_waiting(info.monitor));
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+
+TEST(FutexMonitorTest, abortBlockedEnter)
+{
+	FutexMonitorTestInfo info;
+	omrthread_t thread = NULL;
+
+	initInfo(&info, "abortBlockedEnter");
+	omrthread_monitor_enter(info.monitor);
+	createJoinableThread(&thread, enterAbortable, &info);
+	omrthread_sleep(100);
+	omrthread_abort(thread);
+	VERBOSE_JOIN(thread, J9THREAD_SUCCESS);
+	ASSERT_EQ(J9THREAD_INTERRUPTED_MONITOR_ENTER, info.rc);
+	ASSERT_TRUE(omrthread_self() == info.monitor->owner);
+	omrthread_monitor_exit(info.monitor);
+	ASSERT_EQ(0, omrthread_monitor_destroy(info.monitor));
+}
+#endif /* OMR_THR_FUTEX_MONITORS */
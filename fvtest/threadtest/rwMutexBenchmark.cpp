@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+#include "threadTestHelp.h"
+
+#define BENCHMARK_MAX_THREADS 64
+#define BENCHMARK_OPERATIONS 400000
+#define BENCHMARK_MIN_OPERATIONS_PER_THREAD 2000
+#define BENCHMARK_DATA_WORDS 8
+
+/* state shared by the threads of one benchmark run */
+typedef struct RWMutexBenchmarkInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t startMonitor;
+	volatile BOOLEAN started;
+	uintptr_t operationsPerThread;
+	uintptr_t writePercentage;
+	volatile uintptr_t writerInside; /* set by a writer for the duration of its critical section */
+	volatile uintptr_t violations; /* critical sections that overlapped a writer */
+	volatile uintptr_t data[BENCHMARK_DATA_WORDS];
+} RWMutexBenchmarkInfo;
+
+/**
+ * Enter the rwmutex for read or write, as chosen by a per-thread pseudo random sequence, for the
+ * configured number of operations. Readers sum the shared data and writers rewrite it; both check
+ * that no writer overlaps them.
+ */
+static int J9THREAD_PROC
+runOperations(void *arg)
+{
+	RWMutexBenchmarkInfo *info = (RWMutexBenchmarkInfo *)arg;
+	uint32_t random = (uint32_t)(uintptr_t)omrthread_self() | 1;
+	uintptr_t sum = 0;
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(info->startMonitor);
+	while (!info->started) {
+		omrthread_monitor_wait(info->startMonitor);
+	}
+	omrthread_monitor_exit(info->startMonitor);
+
+	for (i = 0; i < info->operationsPerThread; i++) {
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		if ((random % 100) < info->writePercentage) {
+			omrthread_rwmutex_enter_write(info->handle);
+			if (0 != info->writerInside) {
+				info->violations += 1;
+			}
+			info->writerInside = 1;
+			for (uintptr_t j = 0; j < BENCHMARK_DATA_WORDS; j++) {
+				info->data[j] += 1;
+			}
+			info->writerInside = 0;
+			omrthread_rwmutex_exit_write(info->handle);
+		} else {
+			omrthread_rwmutex_enter_read(info->handle);
+			for (uintptr_t j = 0; j < BENCHMARK_DATA_WORDS; j++) {
+				sum += info->data[j];
+			}
+			if (0 != info->writerInside) {
+				omrthread_rwmutex_exit_read(info->handle);
+				omrthread_rwmutex_enter_write(info->handle);
+				info->violations += 1;
+				omrthread_rwmutex_exit_write(info->handle);
+			} else {
+				omrthread_rwmutex_exit_read(info->handle);
+			}
+		}
+	}
+
+	return (int)(sum & 1);
+}
+
+/**
+ * Run one configuration and return the elapsed time in microseconds.
+ */
+static uint64_t
+runBenchmark(uintptr_t flags, uintptr_t threadCount, uintptr_t writePercentage, uintptr_t *violations)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	RWMutexBenchmarkInfo info;
+	omrthread_t threads[BENCHMARK_MAX_THREADS];
+
+	memset(&info, 0, sizeof(info));
+	info.operationsPerThread = OMR_MAX(BENCHMARK_OPERATIONS / threadCount, BENCHMARK_MIN_OPERATIONS_PER_THREAD);
+	info.writePercentage = writePercentage;
+	EXPECT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&info.handle, flags, "rwmutex benchmark"));
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&info.startMonitor, 0, "rwmutex benchmark start"));
+
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		createJoinableThread(&threads[i], runOperations, &info);
+	}
+	uint64_t startTime = omrtime_hires_clock();
+	omrthread_monitor_enter(info.startMonitor);
+	info.started = TRUE;
+	omrthread_monitor_notify_all(info.startMonitor);
+	omrthread_monitor_exit(info.startMonitor);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	*violations = info.violations;
+	omrthread_monitor_destroy(info.startMonitor);
+	omrthread_rwmutex_destroy(info.handle);
+	return OMR_MAX(elapsed, 1);
+}
+
+/**
+ * Compare the throughput of the default and reader-biased rwmutex flavours for 1 to 64 threads, of which
+ * 0%, 1% or 10% of the operations enter for write. Use -logLevel=verbose to see the results.
+ */
+TEST(RWMutexPerfTest, ReadMostly)
+{
+	static const uintptr_t threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+	static const uintptr_t writePercentages[] = {0, 1, 10};
+
+	for (uintptr_t w = 0; w < sizeof(writePercentages) / sizeof(writePercentages[0]); w++) {
+		for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+			uintptr_t threadCount = threadCounts[t];
+			uintptr_t operations = threadCount * OMR_MAX(BENCHMARK_OPERATIONS / threadCount, BENCHMARK_MIN_OPERATIONS_PER_THREAD);
+			uintptr_t violations = 0;
+			uint64_t defaultTime = runBenchmark(0, threadCount, writePercentages[w], &violations);
+			EXPECT_EQ((uintptr_t)0, violations) << "default rwmutex let a writer overlap another critical section";
+			uint64_t biasedTime = runBenchmark(J9THREAD_RWMUTEX_READER_BIASED, threadCount, writePercentages[w], &violations);
+			EXPECT_EQ((uintptr_t)0, violations) << "reader-biased rwmutex let a writer overlap another critical section";
+			omrTestEnv->log(LEVEL_VERBOSE, "%2zu threads, %2zu%% writes: default %6llu ns/op, reader-biased %6llu ns/op\n",
+				threadCount, writePercentages[w], (defaultTime * 1000) / operations, (biasedTime * 1000) / operations);
+		}
+	}
+}
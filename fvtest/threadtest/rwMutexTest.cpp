@@ -34,6 +34,22 @@
 
 extern ThreadTestEnvironment *omrTestEnv;
 
+/* flags passed to omrthread_rwmutex_init by createSupportThreadInfo, set for each test from its parameter */
+static uintptr_t rwmutexFlags = 0;
+
+/**
+ * The tests run against each flavour of rwmutex, given by the flags passed to omrthread_rwmutex_init.
+ */
+class RWMutex : public ::testing::TestWithParam<uintptr_t>
+{
+protected:
+	virtual void
+	SetUp()
+	{
+		rwmutexFlags = GetParam();
+	}
+};
+
 /* structure used to pass info to concurrent threads for some tests */
 typedef struct SupportThreadInfo {
 	volatile omrthread_rwmutex_t handle;
@@ -103,7 +119,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, rwmutexFlags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -261,11 +277,11 @@ J9THREAD_PROC nop(SupportThreadInfo *info)
 /**
  * validate that we can create a reate/write mutex successfully
  */
-TEST(RWMutex, CreateTest)
+TEST_P(RWMutex, CreateTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -279,11 +295,11 @@ TEST(RWMutex, CreateTest)
 /**
  * Validate that we can enter/exit a RWMutex for read
  */
-TEST(RWMutex, RWReadEnterExitTest)
+TEST_P(RWMutex, RWReadEnterExitTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -303,11 +319,11 @@ TEST(RWMutex, RWReadEnterExitTest)
 /**
  * Validate that we can enter/exit a RWMutex for write
  */
-TEST(RWMutex, RWWriteEnterExitTest)
+TEST_P(RWMutex, RWWriteEnterExitTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -333,11 +349,11 @@ TEST(RWMutex, RWWriteEnterExitTest)
 /**
  * Validate that is_writelocked return true in writing state
  */
-TEST(RWMutex, IsWriteLockedTest)
+TEST_P(RWMutex, IsWriteLockedTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	BOOLEAN ret;
 	const char *mutexName = "test_mutex";
 
@@ -370,7 +386,7 @@ TEST(RWMutex, IsWriteLockedTest)
 	ASSERT_TRUE(0 == result);
 }
 
-TEST(RWMutex, MultipleReadersTest)
+TEST_P(RWMutex, MultipleReadersTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -401,7 +417,7 @@ TEST(RWMutex, MultipleReadersTest)
  * readers are excludes while another thread holds the rwmutex for write
  * once writer exits, reader can enter
  */
-TEST(RWMutex, ReadersExcludedTest)
+TEST_P(RWMutex, ReadersExcludedTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -438,7 +454,7 @@ TEST(RWMutex, ReadersExcludedTest)
  * readers are excludes while another thread holds the rwmutex for write entered using try_enter
  * once writer exits, reader can enter
  */
-TEST(RWMutex, ReadersExcludedTesttryenter)
+TEST_P(RWMutex, ReadersExcludedTesttryenter)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -475,7 +491,7 @@ TEST(RWMutex, ReadersExcludedTesttryenter)
  * writer is excluded while another thread holds the rwmutex for read
  * once reader exits writer can enter
  */
-TEST(RWMutex, WritersExcludedTest)
+TEST_P(RWMutex, WritersExcludedTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -512,7 +528,7 @@ TEST(RWMutex, WritersExcludedTest)
  * writer is excluded while another thread holds the rwmutex for write
  * once writer exits second writer can enter
  */
-TEST(RWMutex, WriterExcludesWriterTest)
+TEST_P(RWMutex, WriterExcludesWriterTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -548,7 +564,7 @@ TEST(RWMutex, WriterExcludesWriterTest)
  * writer is excluded while another thread holds the rwmutex for write
  * once writer exits second writer can enter
  */
-TEST(RWMutex, WriterExcludesWriterTesttryenter)
+TEST_P(RWMutex, WriterExcludesWriterTesttryenter)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
@@ -583,7 +599,7 @@ TEST(RWMutex, WriterExcludesWriterTesttryenter)
  * reader can enter rwmutex even if write is pending (waiting on another reader)
  * 2nd reader to enter rwmutex continues to block write after first thread exits
  */
-TEST(RWMutex, SecondReaderExcludesWrite)
+TEST_P(RWMutex, SecondReaderExcludesWrite)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *info;
@@ -653,7 +669,7 @@ TEST(RWMutex, SecondReaderExcludesWrite)
  * readers are excludes while another thread holds the rwmutex for write
  * once writer exits, all readers wake up and can enter
  */
-TEST(RWMutex, AllReadersProceedTest)
+TEST_P(RWMutex, AllReadersProceedTest)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *infoReader1;
@@ -730,7 +746,7 @@ TEST(RWMutex, AllReadersProceedTest)
  * a thread waiting to enter a rwmutex wakes up and enter when the last exit for
  *   a series of recusive enters is called
  */
-TEST(RWMutex, RecursiveReadTest)
+TEST_P(RWMutex, RecursiveReadTest)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -825,7 +841,7 @@ TEST(RWMutex, RecursiveReadTest)
  * 		exits to enters have been called
  * threads waiting to enter for read wake up and enter when the last exit for read occurs
  */
-TEST(RWMutex, RecursiveWriteTest)
+TEST_P(RWMutex, RecursiveWriteTest)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -913,7 +929,7 @@ TEST(RWMutex, RecursiveWriteTest)
  * threads waiting to enter for read wake up and enter when the last exit for read occurs
  * 		when try_enter was used for one of the enters
  */
-TEST(RWMutex, RecursiveWriteTesttryenter)
+TEST_P(RWMutex, RecursiveWriteTesttryenter)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -996,7 +1012,7 @@ TEST(RWMutex, RecursiveWriteTesttryenter)
  * This test validates that
  * a thread can enter a rwmutex for read after it already has it for write
  */
-TEST(RWMutex, ReadAfterWriteTest)
+TEST_P(RWMutex, ReadAfterWriteTest)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *infoWriter;
@@ -1083,7 +1099,7 @@ TEST(RWMutex, ReadAfterWriteTest)
  * writer is excluded while another thread holds the rwmutex for read but
  * does not block if try_enter_write was used instead of enter_write
  */
-TEST(RWMutex, WritersExcludedNonBlockTest)
+TEST_P(RWMutex, WritersExcludedNonBlockTest)
 {
 	intptr_t result = 0;
 	SupportThreadInfo *info;
@@ -1113,7 +1129,7 @@ TEST(RWMutex, WritersExcludedNonBlockTest)
  * writer is excluded while another thread holds the rwmutex for write but
  * does not block if try_enter_write was used instead of enter_write
  */
-TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
+TEST_P(RWMutex, WritersExcludedByWriterNonBlockTest)
 {
 	intptr_t result = 0;
 	SupportThreadInfo *info;
@@ -1136,3 +1152,5 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+INSTANTIATE_TEST_CASE_P(Flavours, RWMutex, ::testing::Values((uintptr_t)0, (uintptr_t)J9THREAD_RWMUTEX_READER_BIASED));
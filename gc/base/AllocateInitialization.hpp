@@ -230,6 +230,8 @@ public:
 					_allocateDescription.payAllocationTax(env);
 					env->restoreObjects(&objectPtr);
 #endif /* OMR_GC_ALLOCATION_TAX */
+					/* count the object towards this thread's allocation sampling interval */
+					env->sampleAllocation(objectPtr, _allocateDescription.getContiguousBytes());
 				}
 			}
 		}
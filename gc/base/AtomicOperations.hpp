@@ -57,6 +57,24 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * Hint that the cache line containing address will soon be read.
+	 */
+	MMINLINE_DEBUG static void
+	prefetch(const void *address)
+	{
+		VM_AtomicSupport::prefetch(address);
+	}
+
+	/**
+	 * Hint that the cache line containing address will soon be written.
+	 */
+	MMINLINE_DEBUG static void
+	prefetchForWrite(void *address)
+	{
+		VM_AtomicSupport::prefetchForWrite(address);
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
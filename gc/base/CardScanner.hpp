@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(CARDSCANNER_HPP_)
+#define CARDSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+#include "omrmodroncore.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OMR_GC_CARD_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define OMR_GC_CARD_SCAN_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OMR_GC_CARD_SCAN_NEON
+#endif
+
+/**
+ * Locates the end of a run of clean cards (e.g., while looking for the next dirty card to clean), a 32 byte
+ * block at a time.
+ * On x86 blocks are handled with SSE2 or, when the compiler targets it, AVX2, and on aarch64 with NEON;
+ * other platforms handle a uintptr_t worth of cards at a time.
+ * @note Relies on CARD_CLEAN being 0.
+ */
+class MM_CardScanner
+{
+	/* Data Members */
+private:
+	enum {
+		BLOCK_CARDS = 32 /**< cards tested per iteration of the block loop */
+	};
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	/**
+	 * Find the first card that is not clean in the range [card, cardTop), one card at a time.
+	 * @param card first card to test
+	 * @param cardTop end of the range (exclusive)
+	 * @return the address of the first card that is not clean, or cardTop if all cards in the range are clean
+	 */
+	MMINLINE static Card *
+	skipCleanCardsScalar(Card *card, Card *cardTop)
+	{
+		while ((card < cardTop) && ((Card)CARD_CLEAN == *card)) {
+			card += 1;
+		}
+		return card;
+	}
+
+	/**
+	 * Find the first card that is not clean in the range [card, cardTop), testing BLOCK_CARDS cards per
+	 * iteration until the run ends. Returns the same result as skipCleanCardsScalar().
+	 * @param card first card to test
+	 * @param cardTop end of the range (exclusive)
+	 * @return the address of the first card that is not clean, or cardTop if all cards in the range are clean
+	 */
+	MMINLINE static Card *
+	skipCleanCards(Card *card, Card *cardTop)
+	{
+		/* runs of clean cards between the cards of a dirty region are short; do not pay for a block load in that case */
+		if ((card < cardTop) && ((Card)CARD_CLEAN != *card)) {
+			return card;
+		}
+#if !defined(OMR_GC_CARD_SCAN_AVX2) && !defined(OMR_GC_CARD_SCAN_SSE2) && !defined(OMR_GC_CARD_SCAN_NEON)
+		/* the word loop needs aligned loads */
+		while ((card < cardTop) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+			if ((Card)CARD_CLEAN != *card) {
+				return card;
+			}
+			card += 1;
+		}
+#endif /* !OMR_GC_CARD_SCAN_AVX2 && !OMR_GC_CARD_SCAN_SSE2 && !OMR_GC_CARD_SCAN_NEON */
+		while (BLOCK_CARDS <= (uintptr_t)(cardTop - card)) {
+#if defined(OMR_GC_CARD_SCAN_AVX2)
+			__m256i cards = _mm256_loadu_si256((const __m256i *)card);
+			if (!_mm256_testz_si256(cards, cards)) {
+				break;
+			}
+#elif defined(OMR_GC_CARD_SCAN_SSE2)
+			__m128i cards = _mm_or_si128(_mm_loadu_si128((const __m128i *)card), _mm_loadu_si128((const __m128i *)card + 1));
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(cards, _mm_setzero_si128()))) {
+				break;
+			}
+#elif defined(OMR_GC_CARD_SCAN_NEON)
+			uint8x16_t cards = vorrq_u8(vld1q_u8((const uint8_t *)card), vld1q_u8((const uint8_t *)card + 16));
+			if (0 != vmaxvq_u8(cards)) {
+				break;
+			}
+#else /* OMR_GC_CARD_SCAN_NEON */
+			uintptr_t cards = 0;
+			for (uintptr_t i = 0; i < (BLOCK_CARDS / sizeof(uintptr_t)); i++) {
+				cards |= ((uintptr_t *)card)[i];
+			}
+			if (0 != cards) {
+				break;
+			}
+#endif /* OMR_GC_CARD_SCAN_AVX2 */
+			card += BLOCK_CARDS;
+		}
+		/* locate the card within the block, or finish the partial block at the end of the range */
+		return skipCleanCardsScalar(card, cardTop);
+	}
+};
+
+#endif /* CARDSCANNER_HPP_ */
@@ -26,6 +26,7 @@
 
 #include "AtomicOperations.hpp"
 #include "CardCleaner.hpp"
+#include "CardScanner.hpp"
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
 #include "Heap.hpp"
@@ -54,6 +55,17 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		_heapAlloc = (void *)heap->getHeapTop();
 		_cardTableVirtualStart = (Card *) ((uintptr_t)_cardTableStart - (((uintptr_t)getHeapBase()) >> CARD_SIZE_SHIFT));
 		initialized = true;
+
+		if (extensions->summaryCardTable) {
+			/* Cards start clean and so do their summary cards */
+			uintptr_t summaryTableSize = calculateSummaryTableSize(cardTableSizeRequired);
+			_summaryTableStart = (Card *)env->getForge()->allocate(summaryTableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _summaryTableStart) {
+				initialized = false;
+			} else {
+				memset((void *)_summaryTableStart, CARD_CLEAN, summaryTableSize);
+			}
+		}
 	}
 
 	return initialized;
@@ -71,6 +83,11 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryTableStart) {
+		env->getForge()->free(_summaryTableStart);
+		_summaryTableStart = NULL;
+	}
 }
 
 uintptr_t
@@ -256,6 +273,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			dirtySummaryCard(card);
 		}
 	}
 }
@@ -270,6 +288,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			dirtySummaryCard(card);
 		}
 	}
 }
@@ -305,14 +324,20 @@ MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, C
 	Card *endCard = high;
 	uintptr_t cardsCleaned = 0;
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
-			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
-			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
-			
-			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
-			cardsCleaned += 1;
+		/* Only look at the cards of summary cards that are not clean */
+		thisCard = skipCleanSummaryCards(thisCard, endCard);
+		Card *spanTop = getSummarySpanTop(thisCard, endCard);
+		while (thisCard < spanTop) {
+			thisCard = MM_CardScanner::skipCleanCards(thisCard, spanTop);
+			if (thisCard < spanTop) {
+				void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
+				void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
+
+				cardCleaner->clean(env, lowAddress, highAddress, thisCard);
+				cardsCleaned += 1;
+				thisCard += 1;
+			}
 		}
-		thisCard += 1;
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
 }
@@ -378,6 +403,18 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	if (NULL != _summaryTableStart) {
+		/* Summary cards wholly within the range become clean.  They are cleared before the cards so that a
+		 * card dirtied after it has been cleared always leaves its summary card dirty.
+		 */
+		uintptr_t firstSummaryIndex = ((uintptr_t)(firstCard - _cardTableStart) + CARDS_PER_SUMMARY_CARD - 1) >> CARD_SUMMARY_SHIFT;
+		uintptr_t lastSummaryIndex = (uintptr_t)(lastCard - _cardTableStart) >> CARD_SUMMARY_SHIFT;
+		if (firstSummaryIndex < lastSummaryIndex) {
+			memset((void *)(_summaryTableStart + firstSummaryIndex), CARD_CLEAN, lastSummaryIndex - firstSummaryIndex);
+			MM_AtomicOperations::writeBarrier();
+		}
+	}
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
@@ -33,7 +33,9 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 
 class MM_EnvironmentBase;
@@ -41,6 +43,12 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/* base2 log of the number of cards tracked by one summary card */
+#define CARD_SUMMARY_SHIFT 9
+
+/* number of cards tracked by one summary card */
+#define CARDS_PER_SUMMARY_CARD ((uintptr_t)1 << CARD_SUMMARY_SHIFT)
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -62,6 +70,7 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	Card *_summaryTableStart; /**< One card per CARDS_PER_SUMMARY_CARD cards, not clean if any of them may be; NULL unless -Xgc:summaryCardTable */
 
 
 public:
@@ -84,6 +93,112 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return The base address of the summary table, or NULL if the card table is not summarized
+	 */
+	Card *getSummaryTableStart() { return _summaryTableStart; };
+
+	/**
+	 * Record in the summary table that a card has been given a non-clean value.  The card must already
+	 * have been written: a clean summary card means that card cleaning may skip all of its cards.
+	 * @param[in] card The card just dirtied
+	 */
+	MMINLINE void
+	dirtySummaryCard(Card *card)
+	{
+		if (NULL != _summaryTableStart) {
+			Card *summaryCard = _summaryTableStart + (((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_SHIFT);
+			if ((Card)CARD_CLEAN == *summaryCard) {
+				/* Publish the card before the summary card that announces it */
+				MM_AtomicOperations::writeBarrier();
+				*summaryCard = (Card)CARD_DIRTY;
+			}
+		}
+	}
+
+	/**
+	 * Find the end of the run of cards that share a summary card with the given card.
+	 * @param[in] card A card
+	 * @param[in] limit The end of the range being scanned
+	 * @return The first card of the next summary card, or limit if that is lower or the card table is not summarized
+	 */
+	MMINLINE Card *
+	getSummarySpanTop(Card *card, Card *limit)
+	{
+		Card *spanTop = limit;
+		if (NULL != _summaryTableStart) {
+			spanTop = _cardTableStart + ((((uintptr_t)(card - _cardTableStart) >> CARD_SUMMARY_SHIFT) + 1) << CARD_SUMMARY_SHIFT);
+			spanTop = OMR_MIN(spanTop, limit);
+		}
+		return spanTop;
+	}
+
+	/**
+	 * Skip the cards covered by clean summary cards.
+	 * @param[in] card The first card to consider
+	 * @param[in] limit The end of the range being scanned (exclusive)
+	 * @return The first card in [card, limit) whose summary card is not clean, or limit
+	 */
+	MMINLINE Card *
+	skipCleanSummaryCards(Card *card, Card *limit)
+	{
+		if (NULL != _summaryTableStart) {
+			card = skipCleanSummaryCards(_cardTableStart, _summaryTableStart, card, limit);
+		}
+		return card;
+	}
+
+	/**
+	 * Skip the cards covered by clean summary cards in an arbitrary card and summary table pair.
+	 * Clean summary cards are skipped a uintptr_t at a time where possible.
+	 * @param[in] cardTableStart The first card of the card table
+	 * @param[in] summaryTableStart The summary card tracking cardTableStart
+	 * @param[in] card The first card to consider
+	 * @param[in] limit The end of the range being scanned (exclusive)
+	 * @return The first card in [card, limit) whose summary card is not clean, or limit
+	 */
+	MMINLINE static Card *
+	skipCleanSummaryCards(Card *cardTableStart, Card *summaryTableStart, Card *card, Card *limit)
+	{
+		if (card < limit) {
+			uintptr_t summaryIndex = (uintptr_t)(card - cardTableStart) >> CARD_SUMMARY_SHIFT;
+			uintptr_t summaryLimit = (((uintptr_t)(limit - cardTableStart)) + CARDS_PER_SUMMARY_CARD - 1) >> CARD_SUMMARY_SHIFT;
+			Card *summaryCard = summaryTableStart + summaryIndex;
+			if ((Card)CARD_CLEAN == *summaryCard) {
+				Card *summaryTop = summaryTableStart + summaryLimit;
+				summaryCard += 1;
+				while ((summaryCard < summaryTop) && (0 != ((uintptr_t)summaryCard % sizeof(uintptr_t))) && ((Card)CARD_CLEAN == *summaryCard)) {
+					summaryCard += 1;
+				}
+				if ((summaryCard < summaryTop) && ((Card)CARD_CLEAN == *summaryCard)) {
+					uintptr_t *summarySlot = (uintptr_t *)summaryCard;
+					uintptr_t *summarySlotTop = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)summaryTop);
+					while ((summarySlot < summarySlotTop) && ((uintptr_t)CARD_CLEAN == *summarySlot)) {
+						summarySlot += 1;
+					}
+					summaryCard = (Card *)summarySlot;
+					while ((summaryCard < summaryTop) && ((Card)CARD_CLEAN == *summaryCard)) {
+						summaryCard += 1;
+					}
+				}
+				card = cardTableStart + ((uintptr_t)(summaryCard - summaryTableStart) << CARD_SUMMARY_SHIFT);
+				card = OMR_MIN(card, limit);
+			}
+		}
+		return card;
+	}
+
+	/**
+	 * Calculate the size of the summary table for a card table of the given size.
+	 * @param[in] cardTableSize The size, in bytes, of the card table
+	 * @return The size, in bytes, of the summary table, a multiple of uintptr_t
+	 */
+	static uintptr_t
+	calculateSummaryTableSize(uintptr_t cardTableSize)
+	{
+		return MM_Math::roundToCeiling(sizeof(uintptr_t), MM_Math::roundToCeiling(CARDS_PER_SUMMARY_CARD, cardTableSize) >> CARD_SUMMARY_SHIFT);
+	}
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -268,6 +383,7 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _summaryTableStart(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -24,6 +24,7 @@
 
 #include "j9nongenerated.h"
 #include "mmhook_common.h"
+#include "mmomrhook_internal.h"
 #include "mmprivatehook.h"
 #include "mmprivatehook_internal.h"
 #include "omrhookable.h"
@@ -89,6 +90,16 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	setEnvironmentId(MM_AtomicOperations::add(&extensions->currentEnvironmentCount, 1) - 1);
 	setAllocationColor(extensions->newThreadAllocationColor);
 
+	if (extensions->allocationSampling) {
+		/* threads must not sample in step with each other */
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		_allocationSamplingSeed = (((uint64_t)(uintptr_t)this) * (uint64_t)0x9E3779B97F4A7C15ULL) ^ omrtime_hires_clock();
+		if (0 == _allocationSamplingSeed) {
+			_allocationSamplingSeed = 1;
+		}
+		_allocationSamplingBytesRemaining = MM_AllocationSamplingStats::nextSampleInterval(&_allocationSamplingSeed, extensions->allocationSamplingInterval);
+	}
+
 	if (extensions->isStandardGC()) {
 		/* pass veryLargeObjectThreshold = 0 to initialize limited size of veryLargeEntryPool for thread (to reduce footprint), 
 		 * but if the threshold is bigger than maxHeap size, we would pass orignal threshold to indicate no veryLargeEntryPool needed 
@@ -119,6 +130,24 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	return _delegate.initialize(this);
 }
 
+void
+MM_EnvironmentBase::takeAllocationSample(omrobjectptr_t object, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = getExtensions();
+
+	if (extensions->allocationSampling) {
+		uintptr_t meanInterval = extensions->allocationSamplingInterval;
+		uintptr_t estimatedBytes = MM_AllocationSamplingStats::estimateSampledBytes(size, meanInterval);
+		extensions->allocationSamplingStats.recordSample(size, estimatedBytes);
+		TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE(extensions->omrHookInterface, _omrVMThread, object, size, estimatedBytes);
+
+		/* Intervals are memoryless, so the rest of the object does not count towards the next one */
+		_allocationSamplingBytesRemaining = MM_AllocationSamplingStats::nextSampleInterval(&_allocationSamplingSeed, meanInterval);
+	} else {
+		_allocationSamplingBytesRemaining = UDATA_MAX;
+	}
+}
+
 void
 MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 {
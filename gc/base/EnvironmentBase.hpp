@@ -145,6 +145,9 @@ public:
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 
+	uintptr_t _allocationSamplingBytesRemaining; /**< Bytes this thread may allocate before its next allocation sample is taken */
+	uint64_t _allocationSamplingSeed; /**< State of the random number generator drawing this thread's allocation sampling intervals */
+
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
 
 	MM_MarkStats _markStats;
@@ -379,6 +382,29 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Account for an object allocated by this thread, and sample it if it completes the thread's current
+	 * sampling interval (see -Xgc:allocationSampling).
+	 * @param object the allocated and initialized object
+	 * @param size the size of the object, in bytes
+	 */
+	MMINLINE void
+	sampleAllocation(omrobjectptr_t object, uintptr_t size)
+	{
+		if (size < _allocationSamplingBytesRemaining) {
+			_allocationSamplingBytesRemaining -= size;
+		} else {
+			takeAllocationSample(object, size);
+		}
+	}
+
+	/**
+	 * Record and report an allocation sample and start the next sampling interval.
+	 * @param object the allocated and initialized object
+	 * @param size the size of the object, in bytes
+	 */
+	void takeAllocationSample(omrobjectptr_t object, uintptr_t size);
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -622,6 +648,8 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytesRemaining(UDATA_MAX)
+		,_allocationSamplingSeed(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -670,6 +698,8 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytesRemaining(UDATA_MAX)
+		,_allocationSamplingSeed(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -96,6 +96,7 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	lnrlOptions.spinCount1 = 256;
 	lnrlOptions.spinCount2 = 32;
 	lnrlOptions.spinCount3 = 45;
+	lnrlOptions.queued = 0;
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 
 	/* there was no GC before VM birth, so this is the first moment we can get "end of previous GC" timestamp */
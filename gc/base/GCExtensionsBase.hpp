@@ -30,6 +30,7 @@
 #include "modronbase.h"
 #include "omr.h"
 
+#include "AllocationSamplingStats.hpp"
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
 #include "BaseVirtual.hpp"
@@ -248,6 +249,10 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool newSpaceTransparentHugePages; /**< if true, committed new space is advised to be backed by transparent huge pages (set through -Xgc:newSpaceTransparentHugePages) */
+	bool oldSpaceTransparentHugePages; /**< if true, committed flat old space is advised to be backed by transparent huge pages (set through -Xgc:oldSpaceTransparentHugePages) */
+	uintptr_t transparentHugePageAdvisedBytes; /**< bytes of committed heap the operating system accepted the transparent huge page advice for */
+	uintptr_t transparentHugePageAdviseFailedBytes; /**< bytes of committed heap the operating system rejected the transparent huge page advice for */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -277,6 +282,8 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	bool allocationSampling; /**< Enabled by -Xgc:allocationSampling.  Sample allocated objects at random and report them through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE */
+	uintptr_t allocationSamplingInterval; /**< Mean number of bytes a thread allocates between samples (set through -Xgc:allocationSamplingInterval=) */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -287,6 +294,7 @@ public:
 	uint32_t largeObjectAllocationProfilingTopK; /**< number of most allocation size we want to track/report in large object allocation profiling */
 	MM_FreeEntrySizeClassStats freeEntrySizeClassStatsSimulated; /**< snapshot of free memory status used for simulated allocator for fragmentation estimation */
 	uintptr_t freeMemoryProfileMaxSizeClasses; /**< maximum number of sizeClass maintained for heap free memory profile (computed from SizeClassRatio) */
+	bool freeListSizeClassIndex; /**< address ordered free lists keep a per size class first-fit index instead of allocation hints (set through -Xgc:freeListSizeClassIndex) */
 
 	volatile OMR_VMThread* gcExclusiveAccessThreadId; /**< thread token that represents the current "winning" thread for performing garbage collection */
 	omrthread_monitor_t gcExclusiveAccessMutex; /**< Mutex used for acquiring gc priviledges as well as for signalling waiting threads that GC has been completed */
@@ -307,8 +315,11 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool adaptiveTLH; /**< Enabled by -Xgc:adaptiveTLH.  Size each TLH refresh from the smoothed allocation rate of its thread rather than in tlhIncrementSize steps */
+	uintptr_t adaptiveTLHInterval; /**< Time (in microseconds) an adaptively sized TLH should last its thread (set through -Xgc:adaptiveTLHInterval=) */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
+	MM_AllocationSamplingStats allocationSamplingStats; /**< Histogram of allocation samples by object size class */
 	uintptr_t bytesAllocatedMost;
 	OMR_VMThread* vmThreadAllocatedMost;
 
@@ -355,6 +366,9 @@ public:
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */	
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
+	bool workPacketStealing; /**< hand out mark work packets through per-thread work-stealing deques before falling back to the shared packet lists (set through -Xgc:workPacketStealing) */
+	uintptr_t workPacketStealingDequeSize; /**< capacity of each GC thread's packet deque; packets that do not fit go to the shared packet lists */
+	uintptr_t markingPrefetchDepth; /**< number of popped objects held in the marking prefetch FIFO before they are scanned; 0 disables prefetching (set through -Xgc:markingPrefetchDepth=) */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 	
@@ -470,6 +484,11 @@ public:
 	double dnssMinimumContraction;
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
+	bool scavengerWorkStealing; /**< distribute scan work through per-thread work-stealing deques of scan caches rather than the shared scan list (set through -Xgc:scavengerWorkStealing) */
+	uintptr_t scavengerWorkStealingDequeSize; /**< capacity of each GC thread's scan cache deque; caches that do not fit go to the shared scan list */
+	uintptr_t scavengerPrefetchDepth; /**< number of slots scanned ahead of the slot being copied, for prefetching referents and copy destinations; 0 disables prefetching (set through -Xgc:scavengerPrefetchDepth=) */
+	uintptr_t scavengerHierarchicalCopyDepth; /**< number of generations of the first reference children of each copied object that are copied right behind it; 0 keeps breadth-first copy order (set through -Xgc:scavengerHierarchicalCopyDepth=) */
+	uintptr_t rememberedSetShards; /**< number of shards the remembered set allocates fragments from and hands out for scanning; 1 keeps a single shard (set through -Xgc:rememberedSetShards=) */
 
 	enum HeapInitializationSplitHeapSection {
 		HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN = 0,
@@ -504,6 +523,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t compactIncrementSize; /**< if non-zero, fragmentation driven compactions only evacuate a window of about this many bytes, which advances through the heap on each compaction (set through -Xgc:compactIncrementSize=) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -630,6 +650,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Write logs (e.g. verbose:gc) to file from a background thread, off the GC pause */
+	uintptr_t asyncLoggingBufferSize; /**< Size of the buffer holding output queued for the -Xgc:asyncLogging writer thread; output is dropped when it is full */
+	bool summaryCardTable; /**< Enabled by -Xgc:summaryCardTable.  Maintain a coarse summary card per CARDS_PER_SUMMARY_CARD cards so card cleaning can skip clean regions (see MM_CardTable) */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc files in the compact binary format (see VerboseBinaryFormat.hpp) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -663,6 +687,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaLocalGC; /**< if true, GC threads are bound round-robin to the NUMA affinity leaders and steal work from threads on their own node first (set through -Xgc:numaLocalGC) */
 
 	bool padToPageSize;
 	
@@ -1278,6 +1303,10 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, newSpaceTransparentHugePages(false)
+		, oldSpaceTransparentHugePages(false)
+		, transparentHugePageAdvisedBytes(0)
+		, transparentHugePageAdviseFailedBytes(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1299,6 +1328,8 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSampling(false)
+		, allocationSamplingInterval(512 * 1024)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1307,6 +1338,7 @@ public:
 		, largeObjectAllocationProfilingSizeClassRatio(120)
 		, largeObjectAllocationProfilingTopK(8)
 		, freeMemoryProfileMaxSizeClasses(0)
+		, freeListSizeClassIndex(false)
 		, gcExclusiveAccessThreadId(NULL)
 		, gcExclusiveAccessMutex(NULL)
 		, _lightweightNonReentrantLockPool(NULL)
@@ -1322,7 +1354,10 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, adaptiveTLH(false)
+		, adaptiveTLHInterval(1000)
 		, allocationStats()
+		, allocationSamplingStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
 		, gcModeString(NULL)
@@ -1358,6 +1393,9 @@ public:
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.0)		
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
+		, workPacketStealing(false)
+		, workPacketStealingDequeSize(16)
+		, markingPrefetchDepth(0)
 		, packetListSplit(0)
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
@@ -1458,6 +1496,11 @@ public:
 		, dnssMinimumContraction(0.0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
+		, scavengerWorkStealing(false)
+		, scavengerWorkStealingDequeSize(1024)
+		, scavengerPrefetchDepth(0)
+		, scavengerHierarchicalCopyDepth(0)
+		, rememberedSetShards(1)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		, globalMaximumContraction(0.05) /* by default, contract must be at most 5% of the committed heap */
@@ -1480,6 +1523,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactIncrementSize(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1575,6 +1619,10 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(256 * 1024)
+		, summaryCardTable(false)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1597,6 +1645,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaLocalGC(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
@@ -126,6 +126,11 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+	/**
+	 * Advise whether the address range should be backed by transparent huge pages.
+	 * @return true if the advice was applied, false if it is not supported by the heap.
+	 */
+	virtual bool adviseHugePages(void *address, uintptr_t size, uintptr_t advice) { return false; }
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCANNER_HPP_)
+#define HEAPMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OMR_GC_HEAPMAP_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define OMR_GC_HEAPMAP_SCAN_SSE2
+#endif
+
+/**
+ * Locates the end of a run of empty heap map words (e.g., dead space in the mark map during sweep).
+ * On x86 the run is scanned a 32 byte block at a time with SSE2 or, when the compiler targets it, AVX2;
+ * other platforms OR together four words per iteration.
+ */
+class MM_HeapMapScanner
+{
+	/* Data Members */
+private:
+	enum {
+		BLOCK_SLOTS = 32 / sizeof(uintptr_t) /**< heap map words tested per iteration of the block loop */
+	};
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	/**
+	 * Find the first non-zero heap map word in the range [heapMapCurrent, heapMapTop), one word at a time.
+	 * @param heapMapCurrent first heap map word to test
+	 * @param heapMapTop end of the range (exclusive)
+	 * @return the address of the first non-zero word, or heapMapTop if all words in the range are zero
+	 */
+	MMINLINE static uintptr_t *
+	skipEmptySlotsScalar(uintptr_t *heapMapCurrent, uintptr_t *heapMapTop)
+	{
+		while ((heapMapCurrent < heapMapTop) && (0 == *heapMapCurrent)) {
+			heapMapCurrent += 1;
+		}
+		return heapMapCurrent;
+	}
+
+	/**
+	 * Find the first non-zero heap map word in the range [heapMapCurrent, heapMapTop), testing BLOCK_SLOTS
+	 * words per iteration until the run ends. Returns the same result as skipEmptySlotsScalar().
+	 * @param heapMapCurrent first heap map word to test
+	 * @param heapMapTop end of the range (exclusive)
+	 * @return the address of the first non-zero word, or heapMapTop if all words in the range are zero
+	 */
+	MMINLINE static uintptr_t *
+	skipEmptySlots(uintptr_t *heapMapCurrent, uintptr_t *heapMapTop)
+	{
+		/* most runs in densely marked areas end at the next word; do not pay for a block load in that case */
+		if ((heapMapCurrent < heapMapTop) && (0 != *heapMapCurrent)) {
+			return heapMapCurrent;
+		}
+		while (BLOCK_SLOTS <= (uintptr_t)(heapMapTop - heapMapCurrent)) {
+#if defined(OMR_GC_HEAPMAP_SCAN_AVX2)
+			__m256i bits = _mm256_loadu_si256((const __m256i *)heapMapCurrent);
+			if (!_mm256_testz_si256(bits, bits)) {
+				break;
+			}
+#elif defined(OMR_GC_HEAPMAP_SCAN_SSE2)
+			__m128i bits = _mm_or_si128(_mm_loadu_si128((const __m128i *)heapMapCurrent), _mm_loadu_si128((const __m128i *)heapMapCurrent + 1));
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) {
+				break;
+			}
+#else /* OMR_GC_HEAPMAP_SCAN_SSE2 */
+			uintptr_t bits = 0;
+			for (uintptr_t i = 0; i < BLOCK_SLOTS; i++) {
+				bits |= heapMapCurrent[i];
+			}
+			if (0 != bits) {
+				break;
+			}
+#endif /* OMR_GC_HEAPMAP_SCAN_AVX2 */
+			heapMapCurrent += BLOCK_SLOTS;
+		}
+		/* locate the non-zero word within the block, or finish the partial block at the end of the range */
+		return skipEmptySlotsScalar(heapMapCurrent, heapMapTop);
+	}
+};
+
+#endif /* HEAPMAPSCANNER_HPP_ */
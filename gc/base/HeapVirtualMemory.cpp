@@ -328,6 +328,18 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Advise whether the address range should be backed by transparent huge pages.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::adviseHugePages(void* address, uintptr_t size, uintptr_t advice)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->adviseHugePages(&_vmemHandle, address, size, advice);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
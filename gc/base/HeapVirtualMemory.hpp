@@ -67,6 +67,7 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual bool adviseHugePages(void* address, uintptr_t size, uintptr_t advice);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
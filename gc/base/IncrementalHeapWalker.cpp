@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrport.h"
+
+#include "IncrementalHeapWalker.hpp"
+
+#include "AtomicOperations.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "ModronAssertions.h"
+#include "ObjectHeapBufferedIterator.hpp"
+#include "ObjectModel.hpp"
+#include "OMRVMInterface.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelTask.hpp"
+
+/* Number of objects walked between two checks of the increment budget */
+#define INCREMENTAL_HEAP_WALK_OBJECTS_PER_CHECK 64
+/* Chunk size used if the sweep has not sized its chunks */
+#define INCREMENTAL_HEAP_WALK_DEFAULT_CHUNK_SIZE (256 * 1024)
+
+/**
+ * Runs an increment of an incremental heap walk on the dispatcher threads.
+ * @ingroup GC_Base
+ */
+class MM_IncrementalHeapWalkTask : public MM_ParallelTask
+{
+private:
+	MM_IncrementalHeapWalker *_heapWalker;
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		_heapWalker->walkChunks(env);
+	}
+
+	MM_IncrementalHeapWalkTask(MM_EnvironmentBase *env, MM_IncrementalHeapWalker *heapWalker)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+MM_IncrementalHeapWalker *
+MM_IncrementalHeapWalker::newInstance(MM_EnvironmentBase *env, MM_ParallelGlobalGC *globalCollector)
+{
+	MM_IncrementalHeapWalker *heapWalker = (MM_IncrementalHeapWalker *)env->getForge()->allocate(sizeof(MM_IncrementalHeapWalker), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != heapWalker) {
+		new(heapWalker) MM_IncrementalHeapWalker(globalCollector);
+		if (!heapWalker->initialize(env)) {
+			heapWalker->kill(env);
+			heapWalker = NULL;
+		}
+	}
+	return heapWalker;
+}
+
+void
+MM_IncrementalHeapWalker::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IncrementalHeapWalker::initialize(MM_EnvironmentBase *env)
+{
+	_markMap = _globalCollector->getMarkingScheme()->getMarkMap();
+	return true;
+}
+
+void
+MM_IncrementalHeapWalker::tearDown(MM_EnvironmentBase *env)
+{
+	freeChunks(env);
+}
+
+void
+MM_IncrementalHeapWalker::freeChunks(MM_EnvironmentBase *env)
+{
+	if (NULL != _chunks) {
+		env->getForge()->free(_chunks);
+		_chunks = NULL;
+	}
+	_chunkCount = 0;
+}
+
+bool
+MM_IncrementalHeapWalker::start(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+
+	freeChunks(env);
+
+	/* A sweep between increments would coalesce the holes and free entries being walked */
+	_globalCollector->completePendingSweep(env);
+
+	/* Mark bits are object starts until the next collection, unless the objects were moved after marking */
+	bool useMarkMap = true;
+	if (prepareHeapForWalk) {
+		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+		_globalCollector->prepareHeapForWalk(env);
+	}
+#if defined(OMR_GC_MODRON_COMPACTION)
+	else if ((0 != extensions->globalGCStats.gcCount) && (extensions->globalGCStats.compactStats._lastHeapCompaction == extensions->globalGCStats.gcCount)) {
+		useMarkMap = false;
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+	uintptr_t chunkSize = extensions->parSweepChunkSize;
+	if (0 == chunkSize) {
+		chunkSize = INCREMENTAL_HEAP_WALK_DEFAULT_CHUNK_SIZE;
+	}
+
+	regionManager->lock();
+
+	/* count the chunks, then fill them in */
+	uintptr_t chunkCount = 0;
+	for (uintptr_t pass = 0; pass < 2; pass++) {
+		GC_HeapRegionIterator regionIterator(regionManager);
+		MM_HeapRegionDescriptor *region = NULL;
+		uintptr_t chunkIndex = 0;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+				uintptr_t regionChunkSize = region->getSize();
+				if (useMarkMap && (MEMORY_TYPE_OLD == (region->getTypeFlags() & MEMORY_TYPE_OLD))) {
+					regionChunkSize = chunkSize;
+				}
+				uintptr_t *base = (uintptr_t *)region->getLowAddress();
+				uintptr_t *regionTop = (uintptr_t *)region->getHighAddress();
+				while (base < regionTop) {
+					uintptr_t *top = regionTop;
+					if (((uintptr_t)regionTop - (uintptr_t)base) > regionChunkSize) {
+						top = (uintptr_t *)((uintptr_t)base + regionChunkSize);
+					}
+					if (0 != pass) {
+						MM_IncrementalHeapWalkChunk *chunk = &_chunks[chunkIndex];
+						chunk->region = region;
+						chunk->base = base;
+						chunk->top = top;
+						chunk->scanPtr = NULL;
+						chunk->scanTop = NULL;
+					}
+					chunkIndex += 1;
+					base = top;
+				}
+			}
+		}
+		if (0 == pass) {
+			chunkCount = chunkIndex;
+			_chunks = (MM_IncrementalHeapWalkChunk *)env->getForge()->allocate(OMR_MAX(chunkCount, 1) * sizeof(MM_IncrementalHeapWalkChunk), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _chunks) {
+				break;
+			}
+		}
+	}
+
+	regionManager->unlock();
+
+	if (NULL == _chunks) {
+		return false;
+	}
+
+	_chunkCount = chunkCount;
+	_firstIncompleteChunk = 0;
+	_partitioned = false;
+	_function = function;
+	_userData = userData;
+	_walkFlags = walkFlags;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	_globalGCCount = extensions->globalGCStats.gcCount;
+#endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	_localGCCount = extensions->scavengerStats._gcCount;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	_heapSize = extensions->heap->getMemorySize();
+	_objectsWalked = 0;
+	return true;
+}
+
+/**
+ * @return true if objects may have moved since the walk was started
+ */
+bool
+MM_IncrementalHeapWalker::isWalkInvalidated(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool invalidated = (_heapSize != extensions->heap->getMemorySize());
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	invalidated = invalidated || (_globalGCCount != extensions->globalGCStats.gcCount);
+#endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	invalidated = invalidated || (_localGCCount != extensions->scavengerStats._gcCount);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	return invalidated;
+}
+
+IncrementalHeapWalkResult
+MM_IncrementalHeapWalker::walk(MM_EnvironmentBase *env, uint64_t timeBudget, uintptr_t objectBudget)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Assert_MM_true(isWalkActive());
+
+	if (isWalkInvalidated(env)) {
+		freeChunks(env);
+		return INCREMENTAL_HEAP_WALK_INVALIDATED;
+	}
+
+	/* TLHs handed out since the last increment have to be made walkable */
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+	_incrementStartTime = omrtime_hires_clock();
+	_timeBudget = timeBudget;
+	_objectBudget = objectBudget;
+	_incrementObjectsWalked = 0;
+	_budgetExhausted = false;
+	_nextChunk = _firstIncompleteChunk;
+
+	MM_IncrementalHeapWalkTask walkTask(env, this);
+	env->getExtensions()->dispatcher->run(env, &walkTask);
+
+	_objectsWalked += _incrementObjectsWalked;
+	while ((_firstIncompleteChunk < _chunkCount) && (_chunks[_firstIncompleteChunk].scanPtr >= _chunks[_firstIncompleteChunk].scanTop)) {
+		_firstIncompleteChunk += 1;
+	}
+	if (_firstIncompleteChunk == _chunkCount) {
+		freeChunks(env);
+		return INCREMENTAL_HEAP_WALK_COMPLETED;
+	}
+	return INCREMENTAL_HEAP_WALK_PAUSED;
+}
+
+/**
+ * Find where the walk of each chunk starts and ends.  The first chunk of a region starts at the region base,
+ * the others at their first marked object, if any; a chunk without one is covered by the walk of the
+ * chunk before it.
+ */
+void
+MM_IncrementalHeapWalker::partitionChunks(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_IncrementalHeapWalkChunk *chunk = &_chunks[i];
+			if (chunk->base == (uintptr_t *)chunk->region->getLowAddress()) {
+				chunk->scanPtr = chunk->base;
+			} else {
+				MM_HeapMapIterator markedObjectIterator(extensions, _markMap, chunk->base, chunk->top, false);
+				chunk->scanPtr = (uintptr_t *)markedObjectIterator.nextObject();
+			}
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t *scanTop = NULL;
+		for (uintptr_t i = _chunkCount; i > 0; i--) {
+			MM_IncrementalHeapWalkChunk *chunk = &_chunks[i - 1];
+			if (chunk->top == (uintptr_t *)chunk->region->getHighAddress()) {
+				scanTop = chunk->top;
+			}
+			if (NULL != chunk->scanPtr) {
+				chunk->scanTop = scanTop;
+				scanTop = chunk->scanPtr;
+			}
+		}
+		_partitioned = true;
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+/**
+ * Account for objects walked by the calling thread and check whether the increment is over.
+ * @return true if the calling thread should stop walking
+ */
+bool
+MM_IncrementalHeapWalker::isBudgetExhausted(MM_EnvironmentBase *env, uintptr_t objectsWalked)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	uintptr_t incrementObjectsWalked = MM_AtomicOperations::add(&_incrementObjectsWalked, objectsWalked);
+	if (!_budgetExhausted) {
+		if ((0 != _objectBudget) && (incrementObjectsWalked >= _objectBudget)) {
+			_budgetExhausted = true;
+		} else if ((0 != _timeBudget) && (omrtime_hires_delta(_incrementStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS) >= _timeBudget)) {
+			_budgetExhausted = true;
+		}
+	}
+	return _budgetExhausted;
+}
+
+/**
+ * Walk a chunk from where the last increment left it until it is done or the budget runs out.
+ */
+void
+MM_IncrementalHeapWalker::walkChunk(MM_EnvironmentBase *env, MM_IncrementalHeapWalkChunk *chunk)
+{
+	if (chunk->scanPtr >= chunk->scanTop) {
+		return;
+	}
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, chunk->region);
+	objectHeapIterator.reset(chunk->scanPtr, chunk->scanTop);
+	uintptr_t objectsWalked = 0;
+	omrobjectptr_t object = NULL;
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		_function(omrVMThread, chunk->region, object, _userData);
+		objectsWalked += 1;
+		if (INCREMENTAL_HEAP_WALK_OBJECTS_PER_CHECK == objectsWalked) {
+			if (isBudgetExhausted(env, objectsWalked)) {
+				/* resume after this object; whatever follows it is an object or a hole */
+				chunk->scanPtr = (uintptr_t *)((uintptr_t)object + extensions->objectModel.getConsumedSizeInBytesWithHeader(object));
+				return;
+			}
+			objectsWalked = 0;
+		}
+	}
+	chunk->scanPtr = chunk->scanTop;
+	isBudgetExhausted(env, objectsWalked);
+}
+
+void
+MM_IncrementalHeapWalker::walkChunks(MM_EnvironmentBase *env)
+{
+	if (!_partitioned) {
+		partitionChunks(env);
+	}
+
+	while (!_budgetExhausted) {
+		uintptr_t chunkIndex = MM_AtomicOperations::add(&_nextChunk, 1) - 1;
+		if (chunkIndex >= _chunkCount) {
+			break;
+		}
+		walkChunk(env, &_chunks[chunkIndex]);
+	}
+}
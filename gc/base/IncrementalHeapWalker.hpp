@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(INCREMENTALHEAPWALKER_HPP_)
+#define INCREMENTALHEAPWALKER_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+
+#include "BaseVirtual.hpp"
+#include "HeapWalker.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
+class MM_MarkMap;
+class MM_ParallelGlobalGC;
+
+/**
+ * Outcome of an increment of an incremental heap walk.
+ */
+typedef enum {
+	INCREMENTAL_HEAP_WALK_PAUSED = 0, /**< The budget ran out, call walk() again at a later safepoint */
+	INCREMENTAL_HEAP_WALK_COMPLETED, /**< Every object has been walked */
+	INCREMENTAL_HEAP_WALK_INVALIDATED /**< The heap was collected or resized since start(); the walk has been abandoned */
+} IncrementalHeapWalkResult;
+
+/**
+ * A section of a heap region walked by one thread at a time.
+ * @ingroup GC_Base
+ */
+class MM_IncrementalHeapWalkChunk
+{
+public:
+	MM_HeapRegionDescriptor *region; /**< Region containing the chunk */
+	uintptr_t *base; /**< Base of the chunk */
+	uintptr_t *top; /**< Top of the chunk */
+	uintptr_t *scanPtr; /**< Next object (or hole) to walk; NULL if no object is known to start in the chunk */
+	uintptr_t *scanTop; /**< End of the walk: the first object of the next non empty chunk in the region, or the region top */
+};
+
+/**
+ * Walks all objects of the heap over a series of short safepoints, using the GC threads.
+ * Regions are divided into chunks the size of the parallel sweep chunks (MM_ParallelSweepChunk), which the
+ * dispatcher threads claim in address order. Each increment ends once its time or object budget is spent;
+ * threads record where they stopped so that the next increment picks up from there.
+ *
+ * A chunk's first object is found with the mark map, either rebuilt by start() or left behind by the last
+ * global collection: marked objects stay where they are until the next collection, so they are safe starting
+ * points even after the mutator has allocated into the space around them. The map is only trusted in old
+ * space, and only if no compaction moved the objects after they were marked; elsewhere a region is walked as
+ * a single chunk.
+ *
+ * Objects that exist for the whole walk are reported exactly once. Objects allocated between increments
+ * may or may not be reported. A collection or heap resize between increments moves objects, so the walk
+ * is abandoned (INCREMENTAL_HEAP_WALK_INVALIDATED) and has to be started again. start() completes any lazy
+ * sweep the last collection left pending, so no chunk is swept underneath the walk before the next collection.
+ *
+ * start() and walk() must be called with exclusive VM access. The object function is called from the GC
+ * threads concurrently and must not allocate or release VM access.
+ * @ingroup GC_Base
+ */
+class MM_IncrementalHeapWalker : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_ParallelGlobalGC *_globalCollector; /**< Collector providing the mark map and heap walk preparation */
+	MM_MarkMap *_markMap; /**< Mark map used to find the first object of each chunk */
+
+	MM_IncrementalHeapWalkChunk *_chunks; /**< Chunks of the current walk, NULL if no walk is in progress */
+	uintptr_t _chunkCount; /**< Number of entries in _chunks */
+	uintptr_t _firstIncompleteChunk; /**< Chunks below this index have been walked */
+	volatile uintptr_t _nextChunk; /**< Next chunk to claim in the current increment */
+	bool _partitioned; /**< True once the scan range of every chunk has been established */
+
+	MM_HeapWalkerObjectFunc _function; /**< Function applied to each object */
+	void *_userData; /**< User data passed to _function */
+	uintptr_t _walkFlags; /**< Region type flags selecting the regions to walk */
+
+	uintptr_t _globalGCCount; /**< Global collection count when the walk was started */
+	uintptr_t _localGCCount; /**< Local collection count when the walk was started, 0 without a scavenger */
+	uintptr_t _heapSize; /**< Heap size when the walk was started */
+
+	uint64_t _incrementStartTime; /**< Start of the current increment (hires clock) */
+	uint64_t _timeBudget; /**< Time budget of the current increment in microseconds, 0 if unlimited */
+	uintptr_t _objectBudget; /**< Object budget of the current increment, 0 if unlimited */
+	volatile uintptr_t _incrementObjectsWalked; /**< Objects walked in the current increment */
+	volatile bool _budgetExhausted; /**< Set when the current increment should stop */
+	uintptr_t _objectsWalked; /**< Objects walked since start() */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool isWalkInvalidated(MM_EnvironmentBase *env);
+	bool isBudgetExhausted(MM_EnvironmentBase *env, uintptr_t objectsWalked);
+	void partitionChunks(MM_EnvironmentBase *env);
+	void walkChunk(MM_EnvironmentBase *env, MM_IncrementalHeapWalkChunk *chunk);
+	void freeChunks(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_IncrementalHeapWalker *newInstance(MM_EnvironmentBase *env, MM_ParallelGlobalGC *globalCollector);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Begin a walk of the heap; no objects are walked until walk() is called.  Any walk in progress is abandoned.
+	 * Sweep work still pending from the last collection is completed first (see MM_ParallelGlobalGC::completePendingSweep()).
+	 * @param function function applied to each object
+	 * @param userData passed to function
+	 * @param walkFlags region type flags selecting the regions to walk (see MM_HeapWalker::allObjectsDo())
+	 * @param prepareHeapForWalk if true, mark the heap first (see MM_ParallelGlobalGC::prepareHeapForWalk()) so that
+	 * every region can be divided into chunks; this pause is as long as a mark
+	 * @return true if the walk was started, false if the chunk table could not be allocated
+	 */
+	bool start(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
+	/**
+	 * Run an increment of the walk on the dispatcher threads. The budgets are checked every few objects,
+	 * so an increment may overrun them slightly.
+	 * @param timeBudget time budget in microseconds, 0 for no limit
+	 * @param objectBudget number of objects to walk, 0 for no limit
+	 * @return the state of the walk after the increment
+	 */
+	IncrementalHeapWalkResult walk(MM_EnvironmentBase *env, uint64_t timeBudget, uintptr_t objectBudget);
+
+	/**
+	 * Abandon the walk in progress, if any.
+	 */
+	void abort(MM_EnvironmentBase *env) { freeChunks(env); }
+
+	/**
+	 * Body of an increment, run by each dispatcher thread.
+	 */
+	void walkChunks(MM_EnvironmentBase *env);
+
+	bool isWalkActive() { return NULL != _chunks; }
+	uintptr_t getChunkCount() { return _chunkCount; }
+	uintptr_t getObjectsWalked() { return _objectsWalked; }
+
+	MM_IncrementalHeapWalker(MM_ParallelGlobalGC *globalCollector)
+		: MM_BaseVirtual()
+		, _globalCollector(globalCollector)
+		, _markMap(NULL)
+		, _chunks(NULL)
+		, _chunkCount(0)
+		, _firstIncompleteChunk(0)
+		, _nextChunk(0)
+		, _partitioned(false)
+		, _function(NULL)
+		, _userData(NULL)
+		, _walkFlags(0)
+		, _globalGCCount(0)
+		, _localGCCount(0)
+		, _heapSize(0)
+		, _incrementStartTime(0)
+		, _timeBudget(0)
+		, _objectBudget(0)
+		, _incrementObjectsWalked(0)
+		, _budgetExhausted(false)
+		, _objectsWalked(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* INCREMENTALHEAPWALKER_HPP_ */
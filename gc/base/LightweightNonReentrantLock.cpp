@@ -87,11 +87,20 @@ MM_LightweightNonReentrantLock::initialize(MM_EnvironmentBase *env, ModronLnrlOp
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
 
-	_initialized = omrgc_spinlock_init(&_spinlock) ? false : true;
-
-	_spinlock.spinCount1 = options->spinCount1;
-	_spinlock.spinCount2 = options->spinCount2;
-	_spinlock.spinCount3 = options->spinCount3;
+	_queued = (0 != options->queued);
+	if (_queued) {
+		_initialized = omrgc_queuedlock_init(&_queuedLock) ? false : true;
+
+		_queuedLock.spinCount1 = options->spinCount1;
+		_queuedLock.spinCount2 = options->spinCount2;
+		_queuedLock.spinCount3 = options->spinCount3;
+	} else {
+		_initialized = omrgc_spinlock_init(&_spinlock) ? false : true;
+
+		_spinlock.spinCount1 = options->spinCount1;
+		_spinlock.spinCount2 = options->spinCount2;
+		_spinlock.spinCount3 = options->spinCount3;
+	}
 #else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 	_initialized = MUTEX_INIT(_mutex) ? true : false;
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
@@ -130,7 +139,11 @@ MM_LightweightNonReentrantLock::tearDown()
 
 	if (_initialized) {
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
-		omrgc_spinlock_destroy(&_spinlock);
+		if (_queued) {
+			omrgc_queuedlock_destroy(&_queuedLock);
+		} else {
+			omrgc_spinlock_destroy(&_spinlock);
+		}
 #else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 		MUTEX_DESTROY(_mutex);
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
@@ -54,7 +54,9 @@ private:
 	MM_GCExtensionsBase *_extensions; /**< cache extensions for use in teardown() */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
+	bool _queued; /**< true if _queuedLock is used rather than _spinlock */
 	J9GCSpinlock _spinlock;
+	J9GCQueuedLock _queuedLock;
 #else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 	MUTEX _mutex;
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
@@ -75,7 +77,7 @@ public:
 	 * Acquire the lock.
 	 * A thread may enter a lock'ed region only once.
 	 * The thread will spin waiting for the lock to become free
-	 * if it is currently in use.
+	 * if it is currently in use (on its own queue node for queued locks).
 	 * 
 	 * @return TRUE on success
 	 * @note Creates a load/store barrier.
@@ -83,7 +85,11 @@ public:
 	MMINLINE bool acquire() 
 	{
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
-		omrgc_spinlock_acquire(&_spinlock, _tracing);
+		if (_queued) {
+			omrgc_queuedlock_acquire(&_queuedLock, _tracing);
+		} else {
+			omrgc_spinlock_acquire(&_spinlock, _tracing);
+		}
 #else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 		MUTEX_ENTER(_mutex);
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
@@ -101,7 +107,11 @@ public:
 	MMINLINE bool release() 
 	{
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
-		omrgc_spinlock_release(&_spinlock);
+		if (_queued) {
+			omrgc_queuedlock_release(&_queuedLock);
+		} else {
+			omrgc_spinlock_release(&_spinlock);
+		}
 #else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 		MUTEX_EXIT(_mutex);
 #endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
@@ -113,6 +123,9 @@ public:
 		_initialized(false),
 		_tracing(NULL),
 		_extensions(NULL)
+#if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
+		, _queued(false)
+#endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
 	{
 		_typeId = __FUNCTION__;
 	};
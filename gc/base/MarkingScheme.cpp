@@ -31,6 +31,7 @@
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "AtomicOperations.hpp"
 #include "Configuration.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -48,6 +49,9 @@
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+/* Upper bound for -Xgc:markingPrefetchDepth; deeper FIFOs only evict lines before they are scanned */
+#define MARKING_PREFETCH_DEPTH_MAX 16
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -97,6 +101,8 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	_prefetchDepth = OMR_MIN(_extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAX);
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -322,6 +328,11 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	if (0 != _prefetchDepth) {
+		completeScanWithPrefetch(env);
+		return;
+	}
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
@@ -331,6 +342,46 @@ MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env)
+{
+	omrobjectptr_t pendingObjects[MARKING_PREFETCH_DEPTH_MAX];
+	uintptr_t pendingHead = 0;
+	uintptr_t pendingCount = 0;
+
+	do {
+		while (true) {
+			/* never block waiting for work while the FIFO still holds objects - they may be the only work left */
+			omrobjectptr_t objectPtr = (omrobjectptr_t)((0 == pendingCount) ? env->_workStack.pop(env) : env->_workStack.popNoWait(env));
+			if (NULL != objectPtr) {
+				MM_AtomicOperations::prefetch(objectPtr);
+				uintptr_t pendingTail = pendingHead + pendingCount;
+				if (pendingTail >= _prefetchDepth) {
+					pendingTail -= _prefetchDepth;
+				}
+				pendingObjects[pendingTail] = objectPtr;
+				pendingCount += 1;
+				if (pendingCount < _prefetchDepth) {
+					continue;
+				}
+			} else if (0 == pendingCount) {
+				break;
+			}
+
+			/* FIFO is full (or no more work is immediately available) - scan the oldest object */
+			objectPtr = pendingObjects[pendingHead];
+			pendingHead += 1;
+			if (pendingHead == _prefetchDepth) {
+				pendingHead = 0;
+			}
+			pendingCount -= 1;
+
+			env->_markStats._bytesScanned += scanObject(env, objectPtr);
+			env->_markStats._objectsScanned += 1;
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
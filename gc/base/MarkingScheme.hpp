@@ -56,6 +56,7 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	uintptr_t _prefetchDepth; /**< number of objects held in the prefetch FIFO of completeScan(), at most MARKING_PREFETCH_DEPTH_MAX; 0 if prefetching is disabled */
 
 public:
 
@@ -80,6 +81,13 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when prefetching is enabled.
+	 * Objects popped from the work stack are prefetched and queued in a FIFO of _prefetchDepth
+	 * entries; each object is scanned once it reaches the head of the FIFO.
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -312,6 +320,7 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _prefetchDepth(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -217,6 +217,17 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Advise whether a range of specified virtual memory instance should be backed by transparent huge pages
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of the range
+	 * @param size size of the range
+	 * @param advice one of the OMRPORT_VMEM_HUGE_PAGES_* values
+	 * @return true if succeed
+	 */
+	bool adviseHugePages(MM_MemoryHandle* handle, void* address, uintptr_t size, uintptr_t advice);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -41,6 +41,7 @@
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -139,6 +140,9 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	_sizeClassIndexEnabled = ext->freeListSizeClassIndex;
+	memset(_sizeClassFirstFit, 0, sizeof(_sizeClassFirstFit));
+
 	return true;
 }
 
@@ -401,6 +405,9 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 {
 	J9ModronAllocateHint *hint = _hintActive;
 
+	/* entries were added to the middle of the list */
+	clearSizeClassIndex();
+
 	while(hint) {
 		if (hint->heapFreeHeader > freeEntry) {
 			hint->heapFreeHeader = freeEntry;
@@ -410,6 +417,79 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+/****************************************
+ * Size-class index Functionality
+ ****************************************
+ */
+
+/**
+ * Forget all size-class positions; subsequent searches start from the head of the free list.
+ * Must be called whenever free entries are added to the list or grow, since either can invalidate
+ * the "all entries up to here are smaller" property of an index position.
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	if (_sizeClassIndexEnabled) {
+		memset(_sizeClassFirstFit, 0, sizeof(_sizeClassFirstFit));
+	}
+}
+
+/**
+ * Find where a first-fit search for lookupSize may start.
+ * The position is itself too small for lookupSize, so the search always steps past it and the
+ * entry eventually found has a valid predecessor for relinking the list.
+ * @return the size-class position for lookupSize, or the free list head if it is unknown or stale
+ */
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassFirstFit(uintptr_t lookupSize)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassFirstFit[MM_Math::floorLog2(lookupSize)];
+
+	/* entries below the list head (or all entries, once it is empty) have been consumed by TLH allocation */
+	if ((NULL == freeEntry) || (NULL == _heapFreeList) || (freeEntry < _heapFreeList)) {
+		freeEntry = _heapFreeList;
+	}
+	return freeEntry;
+}
+
+/**
+ * Record the result of a successful first-fit search for lookupSize.
+ * @param sizeClassPosition the last entry visited before the first one at least as large as the lookup size class, or NULL
+ * @param previousFreeEntry the entry preceding the one satisfying the search, or NULL; it and every entry below it are smaller than lookupSize
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndex(uintptr_t lookupSize, MM_HeapLinkedFreeHeader *sizeClassPosition, MM_HeapLinkedFreeHeader *previousFreeEntry)
+{
+	uintptr_t sizeClass = MM_Math::floorLog2(lookupSize);
+	_sizeClassFirstFit[sizeClass] = sizeClassPosition;
+
+	/* every entry up to previousFreeEntry is smaller than 2^(sizeClass + 1), so larger classes may skip ahead to it */
+	if (NULL != previousFreeEntry) {
+		for (uintptr_t largerClass = sizeClass + 1; largerClass < FREE_LIST_SIZE_CLASS_COUNT; largerClass++) {
+			if ((NULL == _sizeClassFirstFit[largerClass]) || (_sizeClassFirstFit[largerClass] < previousFreeEntry)) {
+				_sizeClassFirstFit[largerClass] = previousFreeEntry;
+			}
+		}
+	}
+}
+
+/**
+ * Update index positions after a free entry shrank (newFreeEntry is its remainder) or was removed from
+ * the list (newFreeEntry is its predecessor, or NULL for the list head).
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	if (_sizeClassIndexEnabled) {
+		for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_COUNT; sizeClass++) {
+			if (oldFreeEntry == _sizeClassFirstFit[sizeClass]) {
+				_sizeClassFirstFit[sizeClass] = newFreeEntry;
+			}
+		}
+	}
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -418,6 +498,9 @@ MMINLINE void *
 MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
 {
 	MM_HeapLinkedFreeHeader  *currentFreeEntry, *previousFreeEntry, *recycleEntry;
+	MM_HeapLinkedFreeHeader *sizeClassPosition;
+	uintptr_t sizeClassMinimum;
+	bool sizeClassPositionFound;
 	uintptr_t candidateHintSize;
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
@@ -438,12 +521,22 @@ retry:
 	walkCount = 0;
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
-
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
+	sizeClassPosition = NULL;
+	sizeClassMinimum = 0;
+	sizeClassPositionFound = true;
+
+	if (_sizeClassIndexEnabled) {
+		/* Start just below the first entry that may be large enough for the size class */
+		currentFreeEntry = findSizeClassFirstFit(sizeInBytesRequired);
+		sizeClassMinimum = (uintptr_t)1 << MM_Math::floorLog2(sizeInBytesRequired);
+		sizeClassPositionFound = false;
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 	}
 
 	while(currentFreeEntry) {
@@ -452,6 +545,13 @@ retry:
 		if (currentFreeEntrySize > largestFreeEntry) {
 			largestFreeEntry = currentFreeEntrySize;
 		}
+		if (!sizeClassPositionFound) {
+			if (currentFreeEntrySize < sizeClassMinimum) {
+				sizeClassPosition = currentFreeEntry;
+			} else {
+				sizeClassPositionFound = true;
+			}
+		}
 		
 		if(sizeInBytesRequired <= currentFreeEntrySize) {
 			break;
@@ -468,6 +568,11 @@ retry:
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
 	}
 
+	/* Searches are recorded with the allocate stats of the caller, so none for Survivor collector allocates */
+	if (NULL != largeObjectAllocateStats) {
+		largeObjectAllocateStats->recordFreeListSearch(walkCount);
+	}
+
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -479,7 +584,9 @@ retry:
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
-	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
+	if (_sizeClassIndexEnabled) {
+		updateSizeClassIndex(sizeInBytesRequired, sizeClassPosition, previousFreeEntry);
+	} else if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
@@ -499,6 +606,7 @@ retry:
 
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext())) {
 		updateHint(currentFreeEntry, recycleEntry);
+		replaceSizeClassIndexEntry(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		/* Adjust the free memory size and count */
@@ -510,6 +618,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		replaceSizeClassIndexEntry(currentFreeEntry, previousFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -646,6 +755,7 @@ retry:
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
 	}
+	/* A size-class position at the consumed head is now below _heapFreeList (or the list is empty) and will be treated as stale */
 
 	if (lockingRequired) {
 		_heapLock.release();
@@ -714,6 +824,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	clearSizeClassIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 
 	_lastFreeEntry = NULL;
@@ -800,6 +911,9 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	/* Free entries may be added below or coalesced with indexed entries */
+	clearSizeClassIndex();
+
 	/* Handle the entries that are too small to make the free list */
 	if(expandSize < _minimumFreeEntrySize) {
 		abandonHeapChunk(lowAddress, highAddress);
@@ -910,6 +1024,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* Indexed entries may be removed or truncated */
+	clearSizeClassIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -997,6 +1114,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
+	clearSizeClassIndex();
+
 	while (currentFreeEntry != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 		currentFreeEntry = currentFreeEntry->getNext();
@@ -1089,6 +1208,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	void *currentFreeEntryTop, *baseAddr, *topAddr;
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry, *nextFreeEntry, *tailFreeEntry;
 
+	clearSizeClassIndex();
+
 	retListHead = NULL;
 	retListTail = NULL;
 	retListMemoryCount = 0;
@@ -1448,6 +1569,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 {
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1497,6 +1620,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	clearSizeClassIndex();
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
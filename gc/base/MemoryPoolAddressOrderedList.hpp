@@ -34,6 +34,9 @@
 #include "EnvironmentBase.hpp"
 
 class MM_AllocateDescription;
+
+/* One size class per power of two: class k holds lookup sizes in [2^k, 2^(k+1)) */
+#define FREE_LIST_SIZE_CLASS_COUNT (sizeof(uintptr_t) * 8)
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -57,6 +60,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size-class index support */
+	bool _sizeClassIndexEnabled; /**< true if object allocates locate their first fit through _sizeClassFirstFit instead of the hints (-Xgc:freeListSizeClassIndex) */
+	MM_HeapLinkedFreeHeader *_sizeClassFirstFit[FREE_LIST_SIZE_CLASS_COUNT]; /**< for each size class k, a free entry smaller than 2^k below which all free entries are also smaller, or NULL to search from the list head */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -73,6 +80,12 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+
+	void clearSizeClassIndex();
+	MM_HeapLinkedFreeHeader *findSizeClassFirstFit(uintptr_t lookupSize);
+	void updateSizeClassIndex(uintptr_t lookupSize, MM_HeapLinkedFreeHeader *sizeClassPosition, MM_HeapLinkedFreeHeader *previousFreeEntry);
+	void replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
+
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
@@ -152,6 +165,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -160,6 +174,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
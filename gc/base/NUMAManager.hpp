@@ -73,18 +73,37 @@ public:
 	/**
 	 * Get low-level NUMA node number from logical node ID.
 	 * @param numaNodeID starting from 1
-	 * If NUMA is explicitly disabled, or not available return 0.
+	 * If NUMA is explicitly disabled, or not available, or numaNodeID is not a known node (such as UDATA_MAX for "no binding") return 0.
 	 */
 	uintptr_t getJ9NodeNumber(uintptr_t numaNodeID) {
 		uintptr_t j9NodeNumber = 0;
 
-		if (_physicalNumaEnabled && (numaNodeID > 0)) {
+		if (_physicalNumaEnabled && (numaNodeID > 0) && (numaNodeID <= _affinityLeaderCount)) {
 			j9NodeNumber = _affinityLeaders[numaNodeID - 1].j9NodeNumber;
 		}
 
 		return j9NodeNumber;
 	}
 
+	/**
+	 * Get the logical node a GC thread is assigned to when GC threads are distributed across nodes (-Xgc:numaLocalGC).
+	 * Slave threads are assigned round-robin so that any prefix of the thread table is spread evenly over the nodes.
+	 * The master (slave ID 0) usually runs on the thread which requested the collection, which the GC doesn't bind,
+	 * so it isn't assigned a node and has no node preference when stealing.
+	 * @param slaveID the slave ID of the GC thread
+	 * @return the logical node ID, starting from 1, or 0 for the master or if NUMA is not enabled or simulated
+	 */
+	uintptr_t getGCThreadNodeID(uintptr_t slaveID) const
+	{
+		uintptr_t numaNodeID = 0;
+
+		if ((0 != _affinityLeaderCount) && (0 != slaveID)) {
+			numaNodeID = ((slaveID - 1) % _affinityLeaderCount) + 1;
+		}
+
+		return numaNodeID;
+	}
+
 	/**
 	 * Called to update internal NUMA caches (could be due to a change in the machine's NUMA state or a change in whether or not we want to enable NUMA (either real or simulated))
 	 * @param env[in] The master GC thread
@@ -114,4 +114,10 @@ MM_NonVirtualMemory::setNumaAffinity(uintptr_t numaNode, void* address, uintptr_
 	return true;
 }
 
+bool
+MM_NonVirtualMemory::adviseHugePages(void* address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return false;
+}
+
 #endif /* (defined(AIXPPC) && (!defined(PPC64) || defined(OMR_GC_REALTIME))) || defined(J9ZOS39064) || defined(OMRZTPF) */
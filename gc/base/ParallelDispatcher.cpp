@@ -76,6 +76,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setSlaveID(slaveID);
 	/* Enviroment initialization specific for GC threads (after slave ID is set) */
 	env->initializeGCThread();
+	dispatcher->setThreadNUMAAffinity(env);
 
 	/* Signal that the thread was created succesfully */
 	slaveInfo->slaveFlags = SLAVE_INFO_FLAG_OK;
@@ -531,6 +532,25 @@ MM_ParallelDispatcher::getThreadPriority()
 	return J9THREAD_PRIORITY_NORMAL;
 }
 
+/**
+ * Bind a dispatcher thread to the NUMA node it is assigned by slave ID, so that the memory it
+ * first touches (and the work it keeps local when stealing) stays on that node. The master isn't
+ * assigned a node (see MM_NUMAManager::getGCThreadNodeID()) and is left unbound.
+ * Only applies with -Xgc:numaLocalGC on hardware with physical NUMA support.
+ */
+void
+MM_ParallelDispatcher::setThreadNUMAAffinity(MM_EnvironmentBase *env)
+{
+	if (_extensions->numaLocalGC && _extensions->_numaManager.isPhysicalNUMASupported()) {
+		uintptr_t numaNodeID = _extensions->_numaManager.getGCThreadNodeID(env->getSlaveID());
+		uintptr_t j9NodeNumber = _extensions->_numaManager.getJ9NodeNumber(numaNodeID);
+		if (0 != j9NodeNumber) {
+			/* failure only costs locality, so it is not fatal */
+			env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+}
+
 /**
  * Mark the slave thread as ready then notify everyone who is waiting
  * on the _slaveThreadMutex.
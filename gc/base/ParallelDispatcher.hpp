@@ -111,6 +111,7 @@ protected:
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
 
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+	void setThreadNUMAAffinity(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
 	
@@ -23,7 +23,9 @@
 
 #include "PhysicalSubArenaVirtualMemory.hpp"
 
-class MM_EnvironmentBase;
+#include "EnvironmentBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
 
 bool
 MM_PhysicalSubArenaVirtualMemory::initialize(MM_EnvironmentBase* env)
@@ -35,6 +37,79 @@ MM_PhysicalSubArenaVirtualMemory::initialize(MM_EnvironmentBase* env)
 	return true;
 }
 
+/**
+ * Select the page policy for memory committed by the receiver.
+ * When enabled and the operating system supports transparent huge pages, committed ranges are advised
+ * to be backed by huge pages and decommits are restricted to whole huge pages.
+ * @param enabled true if the owning space requested transparent huge page backing
+ */
+void
+MM_PhysicalSubArenaVirtualMemory::initializeTransparentHugePages(MM_EnvironmentBase* env, bool enabled)
+{
+	_transparentHugePageSize = 0;
+	if (enabled) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_transparentHugePageSize = omrvmem_transparent_huge_page_size();
+	}
+}
+
+/**
+ * Commit the address range into physical memory, applying the page policy of the receiver.
+ * With transparent huge pages the range is grown to whole huge pages (within the heap), so that the
+ * committed and advised mappings end on huge page boundaries and the pages at either end can be huge.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_PhysicalSubArenaVirtualMemory::commitHeapMemory(MM_EnvironmentBase* env, void* address, uintptr_t size)
+{
+	bool result = true;
+
+	if (0 == _transparentHugePageSize) {
+		result = _heap->commitMemory(address, size);
+	} else {
+		uintptr_t commitBase = OMR_MAX(MM_Math::roundToFloor(_transparentHugePageSize, (uintptr_t)address), (uintptr_t)_heap->getHeapBase());
+		uintptr_t commitTop = OMR_MIN(MM_Math::roundToCeiling(_transparentHugePageSize, (uintptr_t)address + size), (uintptr_t)_heap->getHeapTop());
+		result = _heap->commitMemory((void*)commitBase, commitTop - commitBase);
+		if (result) {
+			/* The range has not been touched yet so huge pages are faulted in as it is allocated into.
+			 * Failure to advise only costs TLB reach, so it does not fail the commit, but it is recorded for verbose.
+			 */
+			MM_GCExtensionsBase *extensions = env->getExtensions();
+			if (_heap->adviseHugePages((void*)commitBase, commitTop - commitBase, OMRPORT_VMEM_HUGE_PAGES_ENABLE)) {
+				extensions->transparentHugePageAdvisedBytes += commitTop - commitBase;
+			} else {
+				extensions->transparentHugePageAdviseFailedBytes += commitTop - commitBase;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Decommit the address range from physical memory, applying the page policy of the receiver.
+ * With transparent huge pages the range is shrunk to whole huge pages, so that a huge page which is
+ * still partly in use is not split by the kernel.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_PhysicalSubArenaVirtualMemory::decommitHeapMemory(MM_EnvironmentBase* env, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	bool result = true;
+
+	if (0 == _transparentHugePageSize) {
+		result = _heap->decommitMemory(address, size, lowValidAddress, highValidAddress);
+	} else {
+		uintptr_t decommitBase = MM_Math::roundToCeiling(_transparentHugePageSize, (uintptr_t)address);
+		uintptr_t decommitTop = MM_Math::roundToFloor(_transparentHugePageSize, (uintptr_t)address + size);
+		if (decommitBase < decommitTop) {
+			result = _heap->decommitMemory((void*)decommitBase, decommitTop - decommitBase, lowValidAddress, highValidAddress);
+		}
+	}
+
+	return result;
+}
+
 /**
  * Find the next valid address higher than the current physical subarenas memory.
  * This routine is typically used for decommit purposes, to find the valid ranges surrounding a particular
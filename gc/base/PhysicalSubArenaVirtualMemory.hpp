@@ -47,9 +47,14 @@ protected:
 	bool _expandFromHighRange, _expandFromLowRange;
 
 	uintptr_t _numaNode;  /**< NUMA node binding, starting from 0. if UDATA_MAX, no explicit binding */
+	uintptr_t _transparentHugePageSize; /**< Size of the transparent huge pages committed memory is advised to be backed by, or 0 if the default page policy applies */
 
 	virtual bool initialize(MM_EnvironmentBase* env);
 
+	void initializeTransparentHugePages(MM_EnvironmentBase* env, bool enabled);
+	bool commitHeapMemory(MM_EnvironmentBase* env, void* address, uintptr_t size);
+	bool decommitHeapMemory(MM_EnvironmentBase* env, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+
 public:
 	MMINLINE MM_PhysicalSubArenaVirtualMemory* getNextSubArena() { return _highArena; }
 	MMINLINE void setNextSubArena(MM_PhysicalSubArenaVirtualMemory* subArena) { _highArena = subArena; }
@@ -106,6 +111,7 @@ public:
 		, _expandFromHighRange(false)
 		, _expandFromLowRange(false)
 		, _numaNode(0)
+		, _transparentHugePageSize(0)
 	{
 		_typeId = __FUNCTION__;
 	};
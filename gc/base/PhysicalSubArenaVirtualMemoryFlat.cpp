@@ -74,6 +74,8 @@ MM_PhysicalSubArenaVirtualMemoryFlat::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	initializeTransparentHugePages(env, env->getExtensions()->oldSpaceTransparentHugePages);
+
 	return true;
 }
 
@@ -108,6 +110,10 @@ MM_PhysicalSubArenaVirtualMemoryFlat::inflate(MM_EnvironmentBase *env)
 {
 	bool result = false;
 	if(_parent->attachSubArena(env, this, _subSpace->getInitialSize(), modron_pavm_attach_policy_none)) {
+		if (0 != _transparentHugePageSize) {
+			/* The attach committed the initial range at heap granularity; extend it to whole huge pages and advise it */
+			commitHeapMemory(env, _lowAddress, calculateOffsetToHighAddress(_lowAddress));
+		}
 		MM_HeapRegionManager *regionManager = getHeapRegionManager();
 		_region = regionManager->createAuxiliaryRegionDescriptor(env, _subSpace->getChildren(), _lowAddress, _highAddress);
 		if(NULL != _region) {
@@ -196,7 +202,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase *env, uin
 	void *highExpandAddress = (void *)(((uintptr_t)_highAddress) + expandSize);
 
 	/* Get the heap memory */
-	if(!_heap->commitMemory(lowExpandAddress, expandSize)) {
+	if(!commitHeapMemory(env, lowExpandAddress, expandSize)) {
 		return 0;
 	}
 
@@ -299,7 +305,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::contract(MM_EnvironmentBase *env, uintptr_
 	genericSubSpace->removeExistingMemory(env, this, contractSize, (void *)contractBase, (void *)contractTop);
 
 	/* Everything is ok - decommit the memory */
-	_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	decommitHeapMemory(env, (void *)contractBase, contractSize, lowValidAddress, highValidAddress);
 
 	/* Success - the area has been contracted.  Update internal values */
 	_highAddress = (void *)contractBase;
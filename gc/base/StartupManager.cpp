@@ -37,19 +37,65 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACT_INCREMENT_SIZE "-Xgc:compactIncrementSize="
+#define OMR_XGCCOMPACT_INCREMENT_SIZE_LENGTH 26
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGER_WORK_STEALING "-Xgc:scavengerWorkStealing"
+#define OMR_XGCSCAVENGER_WORK_STEALING_LENGTH 26
+#define OMR_XGCSCAVENGER_PREFETCH_DEPTH "-Xgc:scavengerPrefetchDepth="
+#define OMR_XGCSCAVENGER_PREFETCH_DEPTH_LENGTH 28
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH "-Xgc:scavengerHierarchicalCopyDepth="
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH 36
+#define OMR_XGCREMEMBERED_SET_SHARDS "-Xgc:rememberedSetShards="
+#define OMR_XGCREMEMBERED_SET_SHARDS_LENGTH 25
+#define OMR_XGCNEW_SPACE_TRANSPARENT_HUGE_PAGES "-Xgc:newSpaceTransparentHugePages"
+#define OMR_XGCNEW_SPACE_TRANSPARENT_HUGE_PAGES_LENGTH 33
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCSUMMARY_CARD_TABLE "-Xgc:summaryCardTable"
+#define OMR_XGCSUMMARY_CARD_TABLE_LENGTH 21
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH 32
+#define OMR_XGCALLOCATION_SAMPLING "-Xgc:allocationSampling"
+#define OMR_XGCALLOCATION_SAMPLING_LENGTH 23
+#define OMR_XGCADAPTIVE_TLH_INTERVAL "-Xgc:adaptiveTLHInterval="
+#define OMR_XGCADAPTIVE_TLH_INTERVAL_LENGTH 25
+#define OMR_XGCADAPTIVE_TLH "-Xgc:adaptiveTLH"
+#define OMR_XGCADAPTIVE_TLH_LENGTH 16
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORK_PACKET_STEALING "-Xgc:workPacketStealing"
+#define OMR_XGCWORK_PACKET_STEALING_LENGTH 23
+#define OMR_XGCMARKING_PREFETCH_DEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH 26
+#define OMR_XGCFREE_LIST_SIZE_CLASS_INDEX "-Xgc:freeListSizeClassIndex"
+#define OMR_XGCFREE_LIST_SIZE_CLASS_INDEX_LENGTH 27
+#define OMR_XGCNUMA_LOCAL_GC "-Xgc:numaLocalGC"
+#define OMR_XGCNUMA_LOCAL_GC_LENGTH 16
+#define OMR_XGCOLD_SPACE_TRANSPARENT_HUGE_PAGES "-Xgc:oldSpaceTransparentHugePages"
+#define OMR_XGCOLD_SPACE_TRANSPARENT_HUGE_PAGES_LENGTH 33
+#define OMR_XGCQUEUED_LOCKS "-Xgc:queuedLocks"
+#define OMR_XGCQUEUED_LOCKS_LENGTH 17
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+#define OMR_XGCCONCURRENT_SWEEP "-Xgc:concurrentSweep"
+#define OMR_XGCCONCURRENT_SWEEP_LENGTH 20
+#define OMR_XGCNO_CONCURRENT_SWEEP "-Xgc:noConcurrentSweep"
+#define OMR_XGCNO_CONCURRENT_SWEEP_LENGTH 22
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +310,14 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_INCREMENT_SIZE, OMR_XGCCOMPACT_INCREMENT_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCCOMPACT_INCREMENT_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->compactIncrementSize = value;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +330,53 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSUMMARY_CARD_TABLE, OMR_XGCSUMMARY_CARD_TABLE_LENGTH)) {
+		extensions->summaryCardTable = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING_INTERVAL, OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH, &value) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingInterval = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING, OMR_XGCALLOCATION_SAMPLING_LENGTH)) {
+		extensions->allocationSampling = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_INTERVAL, OMR_XGCADAPTIVE_TLH_INTERVAL_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCADAPTIVE_TLH_INTERVAL_LENGTH, &value)) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->adaptiveTLHInterval = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH, OMR_XGCADAPTIVE_TLH_LENGTH)) {
+		extensions->adaptiveTLH = true;
+	}
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SWEEP, OMR_XGCCONCURRENT_SWEEP_LENGTH)) {
+		extensions->concurrentSweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_CONCURRENT_SWEEP, OMR_XGCNO_CONCURRENT_SWEEP_LENGTH)) {
+		extensions->concurrentSweep = false;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +388,38 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_WORK_STEALING, OMR_XGCSCAVENGER_WORK_STEALING_LENGTH)) {
+		extensions->scavengerWorkStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PREFETCH_DEPTH, OMR_XGCSCAVENGER_PREFETCH_DEPTH_LENGTH)) {
+		uintptr_t prefetchDepth = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PREFETCH_DEPTH_LENGTH, &prefetchDepth)) {
+			result = false;
+		} else {
+			extensions->scavengerPrefetchDepth = prefetchDepth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH, OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH)) {
+		uintptr_t copyDepth = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH, &copyDepth)) {
+			result = false;
+		} else {
+			extensions->scavengerHierarchicalCopyDepth = copyDepth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBERED_SET_SHARDS, OMR_XGCREMEMBERED_SET_SHARDS_LENGTH)) {
+		uintptr_t shards = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCREMEMBERED_SET_SHARDS_LENGTH, &shards)) || (0 == shards) || (OMR_SUBLIST_POOL_MAX_SHARDS < shards)) {
+			result = false;
+		} else {
+			extensions->rememberedSetShards = shards;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCNEW_SPACE_TRANSPARENT_HUGE_PAGES, OMR_XGCNEW_SPACE_TRANSPARENT_HUGE_PAGES_LENGTH)) {
+		extensions->newSpaceTransparentHugePages = true;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -295,6 +428,26 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+	} else if (0 == strncmp(option, OMR_XGCWORK_PACKET_STEALING, OMR_XGCWORK_PACKET_STEALING_LENGTH)) {
+		extensions->workPacketStealing = true;
+	} else if (0 == strncmp(option, OMR_XGCMARKING_PREFETCH_DEPTH, OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH)) {
+		uintptr_t prefetchDepth = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH, &prefetchDepth)) {
+			result = false;
+		} else {
+			extensions->markingPrefetchDepth = prefetchDepth;
+		}
+	} else if (0 == strncmp(option, OMR_XGCFREE_LIST_SIZE_CLASS_INDEX, OMR_XGCFREE_LIST_SIZE_CLASS_INDEX_LENGTH)) {
+		extensions->freeListSizeClassIndex = true;
+	} else if (0 == strncmp(option, OMR_XGCNUMA_LOCAL_GC, OMR_XGCNUMA_LOCAL_GC_LENGTH)) {
+		extensions->numaLocalGC = true;
+		if (!extensions->numaForced) {
+			extensions->_numaManager.shouldEnablePhysicalNUMA(true);
+		}
+	} else if (0 == strncmp(option, OMR_XGCOLD_SPACE_TRANSPARENT_HUGE_PAGES, OMR_XGCOLD_SPACE_TRANSPARENT_HUGE_PAGES_LENGTH)) {
+		extensions->oldSpaceTransparentHugePages = true;
+	} else if (0 == strncmp(option, OMR_XGCQUEUED_LOCKS, OMR_XGCQUEUED_LOCKS_LENGTH)) {
+		extensions->lnrlOptions.queued = 1;
 	} else {
 		/* unknown option */
 		result = false;
@@ -54,6 +54,10 @@
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+/* Weight of the history when smoothing the allocation rate of a thread for -Xgc:adaptiveTLH */
+#define ADAPTIVE_TLH_RATE_HISTORY_WEIGHT ((float)0.7)
+
 /**
  * Report clearing of a full allocation cache
  */
@@ -142,7 +146,66 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->adaptiveTLH) {
+		if (!_refreshedSinceRestart) {
+			/* The thread did not refresh over the whole cycle so its TLH (returned to the heap by the GC)
+			 * stranded memory; decay its rate so that an idle thread shrinks towards tlhMinimumSize.
+			 */
+			_allocationRate /= 2;
+			refreshSize = getAdaptiveRefreshSize(env);
+		}
+		/* The time spent in the GC is not allocation time */
+		_lastRefreshTime = 0;
+		_refreshedSinceRestart = false;
+		_tlh->refreshSize = refreshSize;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+/**
+ * Compute the size of the next refresh for -Xgc:adaptiveTLH, so that a TLH lasts the owning thread
+ * adaptiveTLHInterval microseconds at its current allocation rate.
+ * @return the refresh size in bytes, between tlhMinimumSize and tlhMaximumSize
+ */
+uintptr_t
+MM_TLHAllocationSupport::getAdaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	float targetSize = _allocationRate * (float)extensions->adaptiveTLHInterval;
+	uintptr_t refreshSize = extensions->tlhMaximumSize;
+
+	if (targetSize < (float)extensions->tlhMaximumSize) {
+		refreshSize = OMR_MAX((uintptr_t)targetSize, extensions->tlhMinimumSize);
+	}
+	return MM_Math::roundToCeiling(env->getObjectAlignmentInBytes(), refreshSize);
+}
+
+/**
+ * Fold the consumption of the TLH about to be replaced into the allocation rate of the owning thread,
+ * and size the next refresh from it (-Xgc:adaptiveTLH only).
+ */
+void
+MM_TLHAllocationSupport::updateAllocationRate(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t now = omrtime_hires_clock();
+
+	/* Without a previous refresh since the last restart (or with a TLH already flushed) there is nothing to measure */
+	if ((0 != _lastRefreshTime) && (NULL != getBase())) {
+		uintptr_t consumed = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+		uint64_t elapsed = OMR_MAX(omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+		float rate = (float)consumed / (float)elapsed;
+
+		if (0.0f == _allocationRate) {
+			_allocationRate = rate;
+		} else {
+			_allocationRate = MM_Math::weightedAverage(_allocationRate, rate, ADAPTIVE_TLH_RATE_HISTORY_WEIGHT);
+		}
+		setRefreshSize(getAdaptiveRefreshSize(env));
+	}
+	_lastRefreshTime = now;
+	_refreshedSinceRestart = true;
 }
 
 /**
@@ -162,13 +225,17 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		/* increase thread hungriness if we did not refresh (adaptive TLHs are sized by allocation rate only) */
+		if (!extensions->adaptiveTLH && (getRefreshSize() < tlhMaximumSize) && (sizeInBytesRequired < tlhMaximumSize)) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
 	}
 
+	if (extensions->adaptiveTLH) {
+		updateAllocationRate(env);
+	}
+
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
 	stats->_tlhDiscardedBytes += getSize();
@@ -192,6 +259,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		}
 		wipeTLH(env);
 	} else {
+		if (NULL != getRealAlloc()) {
+			/* The remainder is too small to reuse and is lost until the next GC */
+			stats->_tlhWastedBytes += getSize();
+		}
 		clear(env);
 	}
 
@@ -276,7 +347,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->adaptiveTLH && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
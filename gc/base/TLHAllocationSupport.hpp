@@ -83,6 +83,10 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	float _allocationRate; /**< Smoothed rate (in bytes per microsecond) at which the owning thread consumes this TLH (-Xgc:adaptiveTLH only) */
+	uint64_t _lastRefreshTime; /**< Time of the last refresh since the last restart, or 0 if there has been none (-Xgc:adaptiveTLH only) */
+	bool _refreshedSinceRestart; /**< True if the TLH was refreshed since the last restart, i.e. the owning thread was not idle over the last GC cycle (-Xgc:adaptiveTLH only) */
+
 public:
 protected:
 private:
@@ -172,6 +176,9 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	uintptr_t getAdaptiveRefreshSize(MM_EnvironmentBase *env);
+	void updateAllocationRate(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -185,7 +192,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_allocationRate(0.0f),
+		_lastRefreshTime(0),
+		_refreshedSinceRestart(false)
 	{};
 
 	/*
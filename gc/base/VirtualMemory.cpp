@@ -268,6 +268,26 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	return result;
 }
 
+bool
+MM_VirtualMemory::adviseHugePages(void* address, uintptr_t byteAmount, uintptr_t advice)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	Assert_MM_true(0 != _pageSize);
+
+	bool result = true;
+
+	/* port library takes page aligned addresses and sizes only */
+	void* adviseBase = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)address);
+	void* adviseTop = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)address + byteAmount);
+
+	if (adviseBase < adviseTop) {
+		uintptr_t adviseSize = ((uintptr_t)adviseTop) - ((uintptr_t)adviseBase);
+		result = 0 == omrvmem_advise_huge_pages(adviseBase, adviseSize, advice, &_identifier);
+	}
+
+	return result;
+}
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
@@ -120,6 +120,17 @@ protected:
 	 */
 	virtual bool setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount);
 
+	/*
+	 * Advise the operating system whether the specified range should be backed by transparent huge pages.
+	 *
+	 * @param[in] address - the start of the range to modify. Will be aligned to page size inside.
+	 * @param byteAmount - the size of the range to modify. Will be aligned to page size inside.
+	 * @param advice - one of the OMRPORT_VMEM_HUGE_PAGES_* values
+	 *
+	 * @return true if the advice was applied, false otherwise
+	 */
+	virtual bool adviseHugePages(void* address, uintptr_t byteAmount, uintptr_t advice);
+
 	/**
 	 * Return the heap base of the virtual memory object.
 	 */
@@ -120,6 +120,25 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Incremental (metronome) marking may yield with work left in packets, so it keeps using the shared lists only */
+	if (_extensions->workPacketStealing && !_extensions->isMetronomeGC()) {
+		_numaLocalStealing = _extensions->numaLocalGC && (1 < _extensions->_numaManager.getAffinityLeaderCount());
+		_packetDequeCount = _extensions->gcThreadCount;
+		_packetDeques = (MM_WorkStealingDeque *)env->getForge()->allocate(_packetDequeCount * sizeof(MM_WorkStealingDeque), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDeques) {
+			_packetDequeCount = 0;
+			return false;
+		}
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			new(&_packetDeques[i]) MM_WorkStealingDeque();
+		}
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			if (!_packetDeques[i].initialize(env, _extensions->workPacketStealingDequeSize, (i + 1) * 0x9E3779B9)) {
+				return false;
+			}
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -224,6 +243,15 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _packetDeques) {
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			_packetDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -262,6 +290,15 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	if (NULL != _packetDeques) {
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			while (NULL != (packet = (MM_Packet *)_packetDeques[i].steal())) {
+				packet->resetData(env);
+				putPacket(env, packet);
+			}
+		}
+	}
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -332,11 +369,82 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| ((NULL != _packetDeques) && !packetDequesEmpty()));
 				
 	return res;
 }
 
+bool
+MM_WorkPackets::packetDequesEmpty()
+{
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		if (!_packetDeques[i].isEmpty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+MM_WorkStealingDeque *
+MM_WorkPackets::getPacketDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+	if ((NULL != _packetDeques) && (NULL != env->_currentTask) && (env->getSlaveID() < _packetDequeCount)) {
+		deque = &_packetDeques[env->getSlaveID()];
+	}
+	return deque;
+}
+
+MM_Packet *
+MM_WorkPackets::getPacketFromDeques(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	MM_WorkStealingDeque *deque = getPacketDeque(env);
+	uintptr_t firstVictim = 0;
+	uintptr_t victimCount = _packetDequeCount;
+	/* with -Xgc:numaLocalGC, peers on this thread's node are tried before peers on other nodes (threads without a deque and the master have no node preference) */
+	uintptr_t passCount = ((NULL != deque) && _numaLocalStealing) ? 2 : 1;
+	uintptr_t nodeID = _extensions->_numaManager.getGCThreadNodeID(env->getSlaveID());
+
+	if (NULL != deque) {
+		/* most recently released packets first - they are the most likely to still be in cache */
+		packet = (MM_Packet *)deque->pop();
+		victimCount = OMR_MIN(env->_currentTask->getThreadCount(), _packetDequeCount);
+		firstVictim = deque->nextVictim(victimCount);
+	}
+
+	for (uintptr_t pass = 0; (NULL == packet) && (pass < passCount); pass++) {
+		uintptr_t victim = firstVictim;
+		for (uintptr_t i = 0; (NULL == packet) && (i < victimCount); i++) {
+			if ((&_packetDeques[victim] != deque)
+				&& ((1 == passCount) || ((0 == pass) == (nodeID == _extensions->_numaManager.getGCThreadNodeID(victim))))
+				&& !_packetDeques[victim].isEmpty()
+			) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.workPacketStealAttempts += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				packet = (MM_Packet *)_packetDeques[victim].steal();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				if (NULL != packet) {
+					env->_workPacketStats.workPacketsStolen += 1;
+				}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			}
+			victim += 1;
+			if (victim == victimCount) {
+				victim = 0;
+			}
+		}
+	}
+
+	if (NULL != packet) {
+		packet->setOwner(env);
+	}
+
+	return packet;
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -384,22 +492,29 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = NULL;
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
 	}
 
-	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
-		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
-				packet = getPacket(env, &_fullPacketList);
+	if (NULL != _packetDeques) {
+		/* Local and peer deques are tried before the lock protected shared lists */
+		packet = getPacketFromDeques(env);
+	}
+
+	if (NULL == packet) {
+		if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
+			if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
+					packet = getPacket(env, &_fullPacketList);
+				}
 			}
-		}
-	} else {
-		if(NULL == (packet = getPacket(env, &_fullPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
-				packet = getPacket(env, &_nonEmptyPacketList);
+		} else {
+			if(NULL == (packet = getPacket(env, &_fullPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
+					packet = getPacket(env, &_nonEmptyPacketList);
+				}
 			}
 		}
 	}
@@ -762,6 +877,21 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	MM_WorkStealingDeque *deque = getPacketDeque(env);
+	if ((NULL != deque) && !packet->isEmpty()) {
+		/* Keep the packet local to this thread; idle threads will steal it if need be */
+		bool mustNotifyWaitingThreads = deque->isEmpty();
+		packet->resetOwner();
+		if (deque->push(packet)) {
+			if (mustNotifyWaitingThreads && (_inputListWaitCount > 0)) {
+				notifyWaitingThreads(env);
+			}
+			return;
+		}
+	}
+
+	/* Overflowed deques, empty packets and non-GC threads go through the shared lists */
 	putPacket(env, packet);
 }
 
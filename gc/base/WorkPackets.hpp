@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -89,6 +90,10 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_packetDeques; /**< per GC thread deques of non-empty packets, indexed by slave ID; NULL unless -Xgc:workPacketStealing */
+	uintptr_t _packetDequeCount; /**< number of entries in _packetDeques */
+	bool _numaLocalStealing; /**< true if packets are stolen from threads on the same NUMA node before other nodes (-Xgc:numaLocalGC with more than one node) */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -96,6 +101,27 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	/**
+	 * Return the packet deque owned by the current thread, if it may use one.
+	 * Only GC threads participating in a task own a deque; other threads (e.g. mutators doing concurrent
+	 * marking) only ever steal.
+	 * @param env[in] the current thread
+	 * @return the deque, or NULL
+	 */
+	MM_WorkStealingDeque *getPacketDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Get an input packet from the current thread's own deque or, failing that, steal one from another thread's deque.
+	 * @param env[in] the current thread
+	 * @return a packet, or NULL if none could be obtained
+	 */
+	MM_Packet *getPacketFromDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Racy check of whether any thread's packet deque holds a packet.
+	 */
+	bool packetDequesEmpty();
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -235,7 +261,10 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_packetDeques(NULL),
+		_packetDequeCount(0),
+		_numaLocalStealing(false)
 	{
 		_typeId = __FUNCTION__;
 	}
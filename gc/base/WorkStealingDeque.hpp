@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define WORKSTEALINGDEQUE_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define WORKSTEALINGDEQUE_CACHE_LINE_SIZE 256
+#else
+#define WORKSTEALINGDEQUE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * Bounded work-stealing deque of opaque work items (Chase-Lev).
+ * The owning GC thread pushes and pops at the bottom without any atomic operation in the common case,
+ * while other GC threads steal the oldest entries from the top with a single compare-and-swap.
+ * The deque never grows: when it is full, push() fails and the caller is expected to publish the item
+ * elsewhere (typically a shared, lock protected list).
+ * @ingroup GC_Base_Core
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry; advanced by thieves, and by the owner when it races for the last entry */
+	uint8_t _topPadding[WORKSTEALINGDEQUE_CACHE_LINE_SIZE - sizeof(uintptr_t)]; /**< keep thieves off the owner's cache line */
+	volatile uintptr_t _bottom; /**< index one past the newest entry; written by the owner only */
+	void * volatile *_entries; /**< circular buffer of _mask + 1 entries */
+	uintptr_t _mask; /**< capacity - 1, capacity is a power of two */
+	uintptr_t _victimSeed; /**< owner private state used to pick steal victims */
+	uint8_t _bottomPadding[WORKSTEALINGDEQUE_CACHE_LINE_SIZE - (4 * sizeof(uintptr_t))]; /**< keep the next deque in an array off this cache line */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Allocate the backing store of the deque.
+	 * @param env[in] the current thread
+	 * @param capacity[in] requested number of entries, rounded up to a power of two
+	 * @param seed[in] initial value for the victim selection sequence (non-zero)
+	 * @return true on success
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Push an item at the bottom. Must only be called by the owning thread.
+	 * @return false if the deque is full, in which case the item was not added
+	 */
+	MMINLINE bool
+	push(void *item)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) > _mask) {
+			return false;
+		}
+		_entries[bottom & _mask] = item;
+		/* entry has to be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed item. Must only be called by the owning thread.
+	 * @return the item, or NULL if the deque is empty (or a thief won the race for the last entry)
+	 */
+	MMINLINE void *
+	pop()
+	{
+		void *item = NULL;
+		uintptr_t bottom = _bottom;
+		if (bottom != _top) {
+			bottom -= 1;
+			_bottom = bottom;
+			/* the store to _bottom must be globally visible before _top is read */
+			MM_AtomicOperations::readWriteBarrier();
+			uintptr_t top = _top;
+			if ((intptr_t)(bottom - top) > 0) {
+				/* more than one entry left, no thief can reach this one */
+				item = _entries[bottom & _mask];
+			} else if (bottom == top) {
+				/* last entry - race with thieves by advancing top ourselves */
+				item = _entries[bottom & _mask];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					item = NULL;
+				}
+				_bottom = top + 1;
+			} else {
+				/* a thief took the last entry */
+				_bottom = top;
+			}
+		}
+		return item;
+	}
+
+	/**
+	 * Steal the oldest item. May be called by any thread.
+	 * @return the item, or NULL if the deque is empty or another thread won the race
+	 */
+	MMINLINE void *
+	steal()
+	{
+		void *item = NULL;
+		uintptr_t top = _top;
+		/* _top must be read before _bottom */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		if ((intptr_t)(bottom - top) > 0) {
+			item = _entries[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				item = NULL;
+			}
+		}
+		return item;
+	}
+
+	/**
+	 * Racy emptiness check, suitable for polling by idle threads
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Return a pseudo-random value in [0, bound) from the owner private sequence (xorshift).
+	 * Must only be called by the owning thread.
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t bound)
+	{
+		uintptr_t x = _victimSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_victimSeed = x;
+		return x % bound;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _entries(NULL)
+		, _mask(0)
+		, _victimSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -192,3 +192,194 @@ omrgc_spinlock_release(J9GCSpinlock *spinlock)
 	}
 	return result;
 }
+
+/**
+ * Wait until a queued lock waiter is granted the lock: spin on the state of its node,
+ * then yield, then block on a semaphore of its own until the releasing thread posts it.
+ * @param[in] lock the lock being waited on
+ * @param[in] node the waiter's node
+ * @param[in] tracing lock statistics, or NULL
+ */
+static void
+queuedLockWaitForGrant(J9GCQueuedLock *lock, J9GCQueuedLockNode *node, J9ThreadMonitorTracing *tracing)
+{
+	uintptr_t spinCount2 = 0;
+	uintptr_t spinCount3 = lock->spinCount3;
+
+	for (; spinCount3 > 0; spinCount3--) {
+		for (spinCount2 = lock->spinCount2; spinCount2 > 0; spinCount2--) {
+			if (J9GC_QUEUEDLOCK_WAITING != node->state) {
+				goto done;
+			}
+
+			MM_AtomicOperations::yieldCPU();
+
+			/* begin tight loop */
+			for (uintptr_t spinCount1 = lock->spinCount1; spinCount1 > 0; spinCount1--)	{
+				MM_AtomicOperations::nop();
+			} /* end tight loop */
+		}
+#if defined(OMR_THR_YIELD_ALG)
+		omrthread_yield_new(spinCount3);
+#else /* OMR_THR_YIELDALG */
+		omrthread_yield();
+#endif /* OMR_THR_YIELDALG */
+	}
+
+	/* Still not granted. Block on the node's own semaphore until the releasing thread posts it. */
+	if (0 == j9sem_init(&node->semaphore, 0)) {
+		if (J9GC_QUEUEDLOCK_WAITING == MM_AtomicOperations::lockCompareExchange(&node->state, J9GC_QUEUEDLOCK_WAITING, J9GC_QUEUEDLOCK_BLOCKED)) {
+			j9sem_wait(node->semaphore);
+			/* the releasing thread still references the node until it has posted the semaphore */
+			while (0 == node->posted) {
+				MM_AtomicOperations::yieldCPU();
+			}
+#if defined(OMR_THR_JLM)
+			if (NULL != tracing) {
+				tracing->slow_count++;
+			}
+#endif /* OMR_THR_JLM */
+		}
+		j9sem_destroy(node->semaphore);
+	} else {
+		/* no semaphore to block on, keep yielding */
+		while (J9GC_QUEUEDLOCK_WAITING == node->state) {
+			omrthread_yield();
+		}
+	}
+
+done:
+#if defined(OMR_THR_JLM)
+	if (NULL != tracing) {
+		uintptr_t yield_count_update = lock->spinCount3 - spinCount3;
+		tracing->yield_count += yield_count_update;
+		tracing->spin2_count += yield_count_update * lock->spinCount2 + (lock->spinCount2 - spinCount2);
+	}
+#endif /* OMR_THR_JLM */
+	return;
+}
+
+/**
+ * Acquire a queued lock.
+ * Contending threads queue up in FIFO order, each spinning on a node on its own cache line.
+ * @param[in] lock queued lock to be acquired
+ * @param[in] lockTracing lock statistics
+ * @return  0 on success or negative value on failure
+ */
+intptr_t
+omrgc_queuedlock_acquire(J9GCQueuedLock *lock, J9ThreadMonitorTracing *lockTracing)
+{
+	J9GCQueuedLockNode *head = &lock->head;
+	volatile uintptr_t *tail = (volatile uintptr_t *)&lock->tail;
+	/* the node must not share its cache line with anything another thread spins on */
+	uint8_t nodeBuffer[2 * J9GC_QUEUEDLOCK_CACHE_LINE_SIZE];
+	J9GCQueuedLockNode *node = (J9GCQueuedLockNode *)(((uintptr_t)nodeBuffer + J9GC_QUEUEDLOCK_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(J9GC_QUEUEDLOCK_CACHE_LINE_SIZE - 1));
+
+	for (;;) {
+		J9GCQueuedLockNode *prev = lock->tail;
+		if (NULL == prev) {
+			/* Free: mark it held without waiters. */
+			if (0 == MM_AtomicOperations::lockCompareExchange(tail, 0, (uintptr_t)head)) {
+				break;
+			}
+		} else {
+			node->next = NULL;
+			node->state = J9GC_QUEUEDLOCK_WAITING;
+			node->posted = 0;
+			node->semaphore = NULL;
+			if ((uintptr_t)prev == MM_AtomicOperations::lockCompareExchange(tail, (uintptr_t)prev, (uintptr_t)node)) {
+				prev->next = node;
+				queuedLockWaitForGrant(lock, node, lockTracing);
+
+				/* We own the lock. Hand our successor, if any, over to the lock so that the node can go away. */
+				J9GCQueuedLockNode *successor = node->next;
+				if (NULL == successor) {
+					head->next = NULL;
+					if ((uintptr_t)node != MM_AtomicOperations::lockCompareExchange(tail, (uintptr_t)node, (uintptr_t)head)) {
+						/* a thread is queueing behind us, wait for it to link itself */
+						while (NULL == (successor = node->next)) {
+							MM_AtomicOperations::yieldCPU();
+						}
+						head->next = successor;
+					}
+				} else {
+					head->next = successor;
+				}
+				break;
+			}
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+#if defined(OMR_THR_JLM)
+	if (NULL != lockTracing) {
+		J9ThreadMonitorTracing *tracing = lockTracing;
+		UPDATE_JLM_MON_ENTER(tracing);
+	}
+#endif /* OMR_THR_JLM */
+	/* On out-of-order memory models (e.g. Power4), ensure that all reads and writes have been completed at this point */
+	MM_AtomicOperations::readWriteBarrier();
+	return 0;
+}
+
+/**
+ * Destroy a queued lock.
+ * @param[in] lock queued lock to be destroyed
+ * @return  0 on success or negative value on failure
+ */
+intptr_t
+omrgc_queuedlock_destroy(J9GCQueuedLock *lock)
+{
+	return 0;
+}
+
+/**
+ * Initialize a queued lock.
+ * @param[in] lock pointer to queued lock to be initialized
+ * @return  0 on success or negative value on failure
+ */
+intptr_t
+omrgc_queuedlock_init(J9GCQueuedLock *lock)
+{
+	lock->head.next = NULL;
+	lock->head.state = J9GC_QUEUEDLOCK_GRANTED;
+	lock->head.posted = 0;
+	lock->head.semaphore = NULL;
+	lock->tail = NULL;
+
+	MM_AtomicOperations::writeBarrier();
+
+	return 0;
+}
+
+/**
+ * Release a queued lock, granting it to the first waiter if there is one.
+ * @param[in] lock queued lock to be released
+ * @return  0 on success or negative value on failure
+ */
+intptr_t
+omrgc_queuedlock_release(J9GCQueuedLock *lock)
+{
+	MM_AtomicOperations::writeBarrier();
+	J9GCQueuedLockNode *head = &lock->head;
+	J9GCQueuedLockNode *successor = head->next;
+
+	if (NULL == successor) {
+		if ((uintptr_t)head == MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&lock->tail, (uintptr_t)head, 0)) {
+			return 0;
+		}
+		/* a thread is queueing behind the owner, wait for it to link itself */
+		while (NULL == (successor = head->next)) {
+			MM_AtomicOperations::yieldCPU();
+		}
+	}
+
+	if (J9GC_QUEUEDLOCK_BLOCKED == MM_AtomicOperations::lockCompareExchange(&successor->state, J9GC_QUEUEDLOCK_WAITING, J9GC_QUEUEDLOCK_GRANTED)) {
+		j9sem_t semaphore = successor->semaphore;
+		successor->state = J9GC_QUEUEDLOCK_GRANTED;
+		j9sem_post(semaphore);
+		MM_AtomicOperations::writeBarrier();
+		successor->posted = 1;
+	}
+	return 0;
+}
@@ -35,10 +35,52 @@ typedef struct J9GCSpinlock {
     uintptr_t spinCount3;
 } J9GCSpinlock;
 
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define J9GC_QUEUEDLOCK_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define J9GC_QUEUEDLOCK_CACHE_LINE_SIZE 256
+#else
+#define J9GC_QUEUEDLOCK_CACHE_LINE_SIZE 64
+#endif
+
+/* states of a queued lock waiter */
+#define J9GC_QUEUEDLOCK_WAITING 0
+#define J9GC_QUEUEDLOCK_BLOCKED 1
+#define J9GC_QUEUEDLOCK_GRANTED 2
+
+/**
+ * A waiter in the queue of a J9GCQueuedLock. Nodes live on the stack of the waiting thread,
+ * each on its own cache line, and are only referenced by the lock until their thread acquires it.
+ */
+typedef struct J9GCQueuedLockNode {
+	struct J9GCQueuedLockNode * volatile next; /**< the waiter queued behind this one */
+	volatile uintptr_t state; /**< J9GC_QUEUEDLOCK_WAITING, _BLOCKED or _GRANTED */
+	volatile uintptr_t posted; /**< set by the releasing thread once it has posted the semaphore of a blocked waiter */
+	j9sem_t semaphore; /**< the semaphore a blocked waiter waits on, private to the node so the thread's park token is left alone */
+} J9GCQueuedLockNode;
+
+/**
+ * MCS queued lock (in the variant which doesn't need a node to be passed from acquire to release).
+ * Waiters spin on the state of their own node rather than on the lock, so a release touches
+ * the cache line of a single waiter and the lock is granted in FIFO order.
+ */
+typedef struct J9GCQueuedLock {
+	J9GCQueuedLockNode head; /**< head.next is the first waiter, maintained by the owner */
+	J9GCQueuedLockNode * volatile tail; /**< the last waiter, &head if held without waiters, NULL if free */
+	uintptr_t spinCount1;
+	uintptr_t spinCount2;
+	uintptr_t spinCount3;
+} J9GCQueuedLock;
+
 
 intptr_t omrgc_spinlock_destroy(J9GCSpinlock *spinlock);
 intptr_t omrgc_spinlock_init(J9GCSpinlock *spinlock);
 intptr_t omrgc_spinlock_release(J9GCSpinlock *spinlock);
 intptr_t omrgc_spinlock_acquire(J9GCSpinlock *spinlock, J9ThreadMonitorTracing*  lockTracing);
 
+intptr_t omrgc_queuedlock_destroy(J9GCQueuedLock *lock);
+intptr_t omrgc_queuedlock_init(J9GCQueuedLock *lock);
+intptr_t omrgc_queuedlock_release(J9GCQueuedLock *lock);
+intptr_t omrgc_queuedlock_acquire(J9GCQueuedLock *lock, J9ThreadMonitorTracing *lockTracing);
+
 #endif /* GCSPINLOCK_HPP_ */
@@ -283,7 +283,10 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 				}
 				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
-				done = true;
+				/* The common case: the region still had cells, so there is no need to take the small allocation
+				 * lock. If the replenish emptied the region it is replaced by the next replenish.
+				 */
+				break;
 			}
 		}
 
@@ -125,8 +125,9 @@ MM_SegregatedAllocationInterface::allocateFromCache(MM_EnvironmentBase* env, uin
 {
 	/* Note we DO NOT keep stats about individual allocations since we can't guarantee all allocations from
 	 * the cache will be done by the GC; the JIT may inline the allocations when the cache isn't empty.
+	 * Callers only come here for small sizes, so the large size class check is not needed.
 	 */
-	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	uintptr_t sizeClass = _sizeClasses->getSizeClassSmall(sizeInBytes);
 	uintptr_t cellSize = _sizeClasses->getCellSize(sizeClass);
 	
 	uintptr_t* cellCurrent = _allocationCache[sizeClass].current;
@@ -313,7 +314,7 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	uintptr_t* cellLink = (uintptr_t*)cacheMemory;
-	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	uintptr_t sizeClass = _sizeClasses->getSizeClassSmall(sizeInBytes);
 
 	/* The allocation cache for the size class being replenished must be empty, otherwise we'd have
 	 * to append the cellLink to the end, which would require traversing the list. There should be no
@@ -340,7 +341,10 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 			&& (_replenishSizes[sizeClass] < extensions->allocationCacheMaximumSize)
 		) {
 			
-			_replenishSizes[sizeClass] += extensions->allocationCacheIncrementSize;
+			/* Grow by at least one cell, otherwise size classes with cells larger than the increment
+			 * take a replenish per cell until the replenish size catches up with the cell size.
+			 */
+			_replenishSizes[sizeClass] += OMR_MAX(extensions->allocationCacheIncrementSize, _sizeClasses->getCellSize(sizeClass));
 		}
 	}
 }
@@ -350,7 +354,7 @@ MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uint
 {
 	/* If cached allocations are disabled, we only allow a replenish the size of the requested allocation. */
 	if (_cachedAllocationsEnabled) {
-		uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+		uintptr_t sizeClass = _sizeClasses->getSizeClassSmall(sizeInBytes);
 		return _replenishSizes[sizeClass];
 	} else {
 		return sizeInBytes;
@@ -440,10 +440,56 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 		}
 		_subAreaTable[i].state = SubAreaEntry::end_heap;
 
+		if (_incremental) {
+			env->_compactStats._incrementWindowBytes = selectIncrementWindow(env);
+			env->_compactStats._incrementHeapBytes = _heap->getActiveMemorySize();
+		}
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+uintptr_t
+MM_CompactScheme::selectIncrementWindow(MM_EnvironmentStandard *env)
+{
+	omrobjectptr_t windowBase = (omrobjectptr_t)_incrementCursor;
+	uintptr_t windowBytes = 0;
+
+	do {
+		bool windowFull = false;
+		_incrementCursor = NULL;
+		windowBytes = 0;
+
+		for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+			if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+				continue;
+			}
+			/* tentative limits are held in freeChunk until the real limits are set */
+			omrobjectptr_t subAreaBase = _subAreaTable[i].freeChunk;
+			if ((subAreaBase < windowBase) || windowFull) {
+				if (windowFull && (NULL == _incrementCursor)) {
+					_incrementCursor = (void *)subAreaBase;
+				}
+				_subAreaTable[i].state = SubAreaEntry::fixup_only;
+			} else {
+				_subAreaTable[i].state = SubAreaEntry::init;
+				windowBytes += (uintptr_t)_subAreaTable[i + 1].freeChunk - (uintptr_t)subAreaBase;
+				windowFull = (windowBytes >= _extensions->compactIncrementSize);
+			}
+		}
+
+		/* The heap may have contracted below the cursor since the last increment - restart from its base */
+		if (0 == windowBytes) {
+			if (NULL == windowBase) {
+				break;
+			}
+			windowBase = NULL;
+		}
+	} while (0 == windowBytes);
+
+	return windowBytes;
+}
+
 /**
  *  Set real limits for each subarea
  */
@@ -550,6 +596,14 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Compactions triggered by an allocation failure must recover as much contiguous free memory as
+		 * possible, so only fragmentation and forced compactions are limited to a single increment.
+		 */
+		CompactReason compactReason = (CompactReason)_extensions->globalGCStats.compactStats._compactReason;
+		_incremental = (0 != _extensions->compactIncrementSize)
+				&& !aggressive
+				&& ((COMPACT_FRAGMENTED == compactReason) || (COMPACT_ALWAYS == compactReason));
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -700,6 +754,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					/* Nothing moved in the sub area, so the holes found by sweep are still free */
+					currentFreeBase = addFreeEntriesInFixupOnlySubArea(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -714,6 +773,23 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void *
+MM_CompactScheme::addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t firstObject, omrobjectptr_t finish)
+{
+	uintptr_t freeBase = (uintptr_t)firstObject;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((uintptr_t)objectPtr > freeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)objectPtr - freeBase);
+		}
+		freeBase = (uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
+	return (freeBase < (uintptr_t)finish) ? (void *)freeBase : NULL;
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1411,7 +1487,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1476,7 +1552,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i+1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
@@ -139,6 +139,8 @@ protected:
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
     MM_CompactDelegate _delegate;
+    bool _incremental; /**< true if the current compaction only evacuates the window starting at _incrementCursor */
+    void *_incrementCursor; /**< Base of the window the next incremental compaction evacuates, or NULL to start from the base of the heap */
 
 public:
 
@@ -161,6 +163,19 @@ protected:
 
 
     void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded);
+    /**
+     * Restrict evacuation to a window of sub areas of about compactIncrementSize bytes starting
+     * at the increment cursor. Sub areas outside of the window are only fixed up.
+     * Must be called by a single thread once the tentative sub area limits have been set.
+     *
+     * This only bounds the move phase of a stop-the-world compaction: the whole heap is still
+     * fixed up within the same pause. Evacuating concurrently, leaving only root fixup
+     * stop-the-world, would need read barriers that the flat heap does not have.
+     *
+     * @param env[in] the current thread
+     * @return the number of bytes of heap in the window
+     */
+    uintptr_t selectIncrementWindow(MM_EnvironmentStandard *env);
     /**
      * Set the real limits for a specific subArea
      *
@@ -219,6 +234,21 @@ protected:
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
+    /**
+     * Add the gaps between the marked objects of a fixup only sub area to the free list.
+     *
+     * @param env[in] the current thread
+     * @param memorySubSpace[in] the subspace owning the sub area
+     * @param poolState[in/out] the free list being rebuilt
+     * @param firstObject[in] the first object in the sub area
+     * @param finish[in] the first object in the following sub area
+     * @return the end of the last marked object if it is followed by free memory, or NULL
+     */
+    void *addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t firstObject,
+					omrobjectptr_t finish);
 
     void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
@@ -336,6 +366,8 @@ public:
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
     	, _delegate()
+    	, _incremental(false)
+    	, _incrementCursor(NULL)
     {
     	_typeId = __FUNCTION__;
     }
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "AtomicOperations.hpp"
+#include "CardScanner.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -609,6 +610,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			dirtySummaryCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -966,6 +968,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			dirtySummaryCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1012,6 +1015,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		dirtySummaryCard(card);
 	}
 
 	return true;
@@ -1636,28 +1640,25 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
 		Card *nextDirtyCard, *currentCard;
+		/* End of the cards covered by the summary card last consulted */
+		Card *summarySpanTop = firstCard;
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
+			/* Is this card clean? If so scan the card table a block at a time until we find
+			 * a card which is not clean or the end of the range. This is based on the premise
+			 * that the card table will be mostly empty. Entering the cards of a new summary
+			 * card, skip whole runs of cards whose summary cards are clean first; none of them
+			 * can be of interest.
+			 */
+			if ((Card)CARD_CLEAN == *currentCard) {
+				while ((currentCard < lastCardToClean) && ((Card)CARD_CLEAN == *currentCard)) {
+					if (currentCard >= summarySpanTop) {
+						currentCard = skipCleanSummaryCards(currentCard, lastCardToClean);
+						summarySpanTop = getSummarySpanTop(currentCard, lastCardToClean);
+					}
+					currentCard = MM_CardScanner::skipCleanCards(currentCard, summarySpanTop);
 				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
 
 				if (currentCard >= lastCardToClean) {
 					break;
@@ -31,6 +31,7 @@
 #include <stdlib.h> 
 
 #include "AtomicOperations.hpp" 
+#include "CardScanner.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentCardTableForWC.hpp"
 #include "ConcurrentGC.hpp"
@@ -350,24 +351,21 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentBase *env, Card
 				firstCard = prepareAddress;
 				endCard = prepareAddress + currentPrepareSize;
 				
+				Card *summarySpanTop = firstCard;
 				for (Card *currentCard = firstCard; currentCard < endCard; currentCard++) {
-					/* Are we are on an uintptr_t boundary ?. If so scan the card table a uintptr_t
-					 * at a time until we find a slot which is non-zero or the end of card table
-					 * found. This is based on the premise that the card table will be mostly
-					 * empty and scanning an uintptr_t at a time will reduce the time taken to
-					 * scan the card table.
+					/* Is this card clean ?. If so scan the card table a block at a time until we
+					 * find a card which is not clean or the end of the range. This is based on the
+					 * premise that the card table will be mostly empty. Cards under a clean summary
+					 * card can be neither dirty nor safe to clean so skip those first.
 					 */
-					if (((Card)CARD_CLEAN == *currentCard) &&
-						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
+					if ((Card)CARD_CLEAN == *currentCard) {
+						while ((currentCard < endCard) && ((Card)CARD_CLEAN == *currentCard)) {
+							if (currentCard >= summarySpanTop) {
+								currentCard = skipCleanSummaryCards(currentCard, endCard);
+								summarySpanTop = getSummarySpanTop(currentCard, endCard);
+							}
+							currentCard = MM_CardScanner::skipCleanCards(currentCard, summarySpanTop);
 						}
-						
-						/*
-						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-						 */
-						currentCard= (Card *)nextSlot; 
 
 						/* End of card table reached ? */
 						if (currentCard >= endCard) {
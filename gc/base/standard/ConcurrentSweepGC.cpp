@@ -0,0 +1,290 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrthread.h"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "ConcurrentSweepGC.hpp"
+
+#include "ConcurrentSweepScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+extern "C" {
+
+/**
+ * Background sweeper thread procedure.
+ * @param info the owning collector
+ * @return always 0
+ */
+static int J9THREAD_PROC
+concurrent_sweeper_thread_proc(void *info)
+{
+	MM_ConcurrentSweepGC *collector = (MM_ConcurrentSweepGC *)info;
+	collector->sweeperEntryPoint();
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_sweeperMonitor, 0, "MM_ConcurrentSweepGC::sweeperMonitor")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sweeperMonitor) {
+		omrthread_monitor_destroy(_sweeperMonitor);
+		_sweeperMonitor = NULL;
+	}
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase *extensions)
+{
+	if (!MM_ParallelGlobalGC::collectorStartup(extensions)) {
+		return false;
+	}
+
+	/* The background sweeper is only an accelerator; allocating threads pay the full sweep debt without it */
+	startSweeperThread(extensions);
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	shutdownSweeperThread(extensions);
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Start the background sweeper thread at minimum priority so that it only consumes spare cycles.
+ * @return true if the thread attached, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::startSweeperThread(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperRequest = CONCURRENT_SWEEPER_WAIT;
+	intptr_t forkResult = createThreadWithCategory(
+		&_sweeperThread,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		concurrent_sweeper_thread_proc,
+		(void *)this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		/* Wait for the thread to report whether it managed to attach */
+		while (!_sweeperStarted) {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+
+	return _sweeperAlive;
+}
+
+/**
+ * Ask the background sweeper to detach and wait for it to do so.
+ */
+void
+MM_ConcurrentSweepGC::shutdownSweeperThread(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperRequest = CONCURRENT_SWEEPER_SHUTDOWN;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	while (_sweeperAlive) {
+		omrthread_monitor_wait(_sweeperMonitor);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+}
+
+void
+MM_ConcurrentSweepGC::setSweeperRequest(ConcurrentSweeperRequest request)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	if (CONCURRENT_SWEEPER_SHUTDOWN != _sweeperRequest) {
+		_sweeperRequest = request;
+		omrthread_monitor_notify_all(_sweeperMonitor);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+}
+
+void
+MM_ConcurrentSweepGC::sweeperEntryPoint()
+{
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "Concurrent Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the sweeper has started (or not) */
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperStarted = true;
+	_sweeperAlive = (NULL != omrThread);
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	omrthread_monitor_exit(_sweeperMonitor);
+	if (NULL == omrThread) {
+		return;
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	env->initializeGCThread();
+
+	ConcurrentSweeperRequest request = CONCURRENT_SWEEPER_WAIT;
+	while (CONCURRENT_SWEEPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweeperMonitor);
+		while (CONCURRENT_SWEEPER_WAIT == (request = _sweeperRequest)) {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+		omrthread_monitor_exit(_sweeperMonitor);
+
+		if (CONCURRENT_SWEEPER_SWEEP == request) {
+			env->acquireVMAccess();
+			uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+			bool completed = getConcurrentSweepScheme()->sweepInBackground(env);
+			env->popVMstate(oldVMstate);
+			env->releaseVMAccess();
+
+			if (completed) {
+				/* Nothing left until the next collection hands over a new sweep */
+				omrthread_monitor_enter(_sweeperMonitor);
+				if (CONCURRENT_SWEEPER_SWEEP == _sweeperRequest) {
+					_sweeperRequest = CONCURRENT_SWEEPER_WAIT;
+				}
+				omrthread_monitor_exit(_sweeperMonitor);
+			} else {
+				/* Let the exclusive access request through before trying again */
+				omrthread_yield();
+			}
+		}
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperAlive = false;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	omrthread_exit(_sweeperMonitor);
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/* Park the background sweeper; whatever debt is left is paid below while the world is stopped */
+	setSweeperRequest(CONCURRENT_SWEEPER_WAIT);
+
+	/* Finish off the previous cycle's sweep so that the heap is walkable and the free lists are complete
+	 * before marking starts.
+	 */
+	MM_ConcurrentSweepScheme *sweepScheme = getConcurrentSweepScheme();
+	if (sweepScheme->isConcurrentSweepActive()) {
+		sweepScheme->completeSweep(env, ABOUT_TO_GC);
+	}
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+void
+MM_ConcurrentSweepGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_ParallelGlobalGC::internalPostCollect(env, subSpace);
+
+	if (getConcurrentSweepScheme()->isConcurrentSweepActive()) {
+		setSweeperRequest(CONCURRENT_SWEEPER_SWEEP);
+	}
+}
+
+/**
+ * Park the background sweeper and finish the outstanding chunks, e.g. before a heap walk.
+ */
+void
+MM_ConcurrentSweepGC::completePendingSweep(MM_EnvironmentBase *env)
+{
+	setSweeperRequest(CONCURRENT_SWEEPER_WAIT);
+	MM_ParallelGlobalGC::completePendingSweep(env);
+}
+
+/**
+ * Pay the allocation tax for the mutator by sweeping a share of the outstanding chunks.
+ */
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	MM_ConcurrentSweepScheme *sweepScheme = getConcurrentSweepScheme();
+	if (sweepScheme->isConcurrentSweepActive()) {
+		uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+		sweepScheme->payAllocationTax(env, baseSubSpace, allocDescription);
+		env->popVMstate(oldVMstate);
+	}
+}
+
+/**
+ * Replenish a pool's free list on demand by sweeping and connecting the next chunks in address order.
+ * @note This call is made under the pool's allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrthread.h"
+
+#include "ParallelGlobalGC.hpp"
+
+/**
+ * State of the background sweeper thread.
+ */
+typedef enum {
+	CONCURRENT_SWEEPER_WAIT = 0, /**< Nothing to sweep, wait for the next collection */
+	CONCURRENT_SWEEPER_SWEEP, /**< Sweep the chunks left behind by the last collection */
+	CONCURRENT_SWEEPER_SHUTDOWN /**< Detach and exit */
+} ConcurrentSweeperRequest;
+
+/**
+ * Flat mark and lazy sweep global collector.
+ * The stop-the-world sweep only runs until an entry large enough for the triggering allocation has been
+ * connected.  The remaining chunks are swept on demand by allocating threads when their free list runs dry
+ * (see MM_ConcurrentSweepScheme::replenishPoolForAllocate()) and by a low priority background thread,
+ * and whatever is left is completed before the next collection.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+private:
+	omrthread_t _sweeperThread; /**< Background sweeper thread */
+	omrthread_monitor_t _sweeperMonitor; /**< Monitor guarding the sweeper request and state flags */
+	volatile ConcurrentSweeperRequest _sweeperRequest; /**< Work requested of the background sweeper */
+	bool _sweeperStarted; /**< True once the background sweeper has reported whether it attached */
+	bool _sweeperAlive; /**< True while the background sweeper is attached */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	bool startSweeperThread(MM_GCExtensionsBase *extensions);
+	void shutdownSweeperThread(MM_GCExtensionsBase *extensions);
+	void setSweeperRequest(ConcurrentSweeperRequest request);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+	virtual void completePendingSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Main loop of the background sweeper thread.  Attaches the calling thread, sweeps whenever a
+	 * collection leaves sweep work behind, and detaches on shutdown.
+	 */
+	void sweeperEntryPoint();
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _sweeperThread(NULL)
+		, _sweeperMonitor(NULL)
+		, _sweeperRequest(CONCURRENT_SWEEPER_WAIT)
+		, _sweeperStarted(false)
+		, _sweeperAlive(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
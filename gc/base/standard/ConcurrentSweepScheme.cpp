@@ -37,6 +37,7 @@
 #include "Dispatcher.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceChildIterator.hpp"
@@ -855,6 +856,8 @@ MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, M
 			MM_AtomicOperations::add((UDATA *)&_stats._concurrentCompleteSweepBytesSwept, chunk->size());
 		} else if (concurrentsweep_mode_stw_complete_sweep == _stats._mode) {
 			MM_AtomicOperations::add((UDATA *)&_stats._completeSweepPhaseBytesSwept, chunk->size());
+		} else if (concurrentsweep_mode_on == _stats._mode) {
+			MM_AtomicOperations::add((UDATA *)&_stats._allocationSweepBytes, chunk->size());
 		}
 		return true;
 	}
@@ -1010,9 +1013,14 @@ MM_ConcurrentSweepScheme::initializeStateForConnections(
 bool
 MM_ConcurrentSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size)
 {
+	bool replenished = false;
+
 	if(isConcurrentSweepActive()) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 		MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
 		MM_MemoryPoolAddressOrderedList *memoryPoolAOL = (MM_MemoryPoolAddressOrderedList *)memoryPool;
+		bool lazySweep = (concurrentsweep_mode_on == _stats._mode);
+		uint64_t startTime = lazySweep ? omrtime_hires_clock() : 0;
 
 		MM_ParallelSweepChunk *chunk;
 		/* Get the sweep state from the pool */
@@ -1026,7 +1034,7 @@ MM_ConcurrentSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_M
 		/* Find the next available chunk to connect.  If a chunk is successfully connected, return.
 		 * Otherwise, find a new chunk until all chunks have been processed.
 		 */
-		while(NULL != (chunk = getNextConnectChunk(envStandard, sweepState))) {
+		while(!replenished && (NULL != (chunk = getNextConnectChunk(envStandard, sweepState)))) {
 #if defined(CONCURRENT_SWEEP_TRACE)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
@@ -1051,16 +1059,18 @@ MM_ConcurrentSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_M
 					}
 
 					/* Successfully connected the chunk.   Check if the allocation request can be satisfied. */
-					if(sweepState->_largestFreeEntry >= size) {
-						return true;
-					}
+					replenished = (sweepState->_largestFreeEntry >= size);
 				}
 			}
 		}
+
+		if(lazySweep) {
+			MM_AtomicOperations::addU64(&_stats._allocationSweepTime, omrtime_hires_clock() - startTime);
+		}
 	}
 
 	/* No more chunks available to connect */
-	return false;
+	return replenished;
 }
 
 /**
@@ -1124,6 +1134,8 @@ MM_ConcurrentSweepScheme::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySub
 		UDATA chunkTax = calculateTax(env, allocationSize);
 		
 		if (chunkTax > 0 ) {	
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t startTime = omrtime_hires_clock();
 			
 			/* First sweep the allocation pool */		
 			MM_MemoryPool *allocPool = subSpace->getMemoryPool(allocationSize);
@@ -1148,6 +1160,8 @@ MM_ConcurrentSweepScheme::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySub
 					chunkTax -= sweepPool(env, memoryPool, chunkTax);
 				}
 			}	
+
+			MM_AtomicOperations::addU64(&_stats._allocationSweepTime, omrtime_hires_clock() - startTime);
 		}	
 	}	
 }
@@ -1491,6 +1505,13 @@ omrtty_printf("[");
 
 	checkRestrictions(env);
 
+	/* Publish how the previous cycle's sweep debt was paid down before the statistics are reset */
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	sweepStats->allocationSweepBytes = _stats._allocationSweepBytes;
+	sweepStats->allocationSweepTime = _stats._allocationSweepTime;
+	sweepStats->backgroundSweepBytes = _stats._backgroundSweepBytes;
+	sweepStats->completeSweepBytes = _stats._completeSweepPhaseBytesSwept;
+
 	_stats.switchMode(concurrentsweep_mode_off, concurrentsweep_mode_stw_find_minimum_free_size);
 
 	setupForSweep(MM_EnvironmentStandard::getEnvironment(env));
@@ -1511,9 +1532,11 @@ omrtty_printf("[");
 			while(NULL != (memoryPool = mssPoolIterator.nextPool())) {
 				state = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
 	        	calculateApproximateFree(env, memoryPool, state);
+				_stats._sweepDebtBytes += state->_heapSizeToConnect - state->_heapSizeConnected;
 			}
 		}
 	}
+	sweepStats->sweepDebtBytes = _stats._sweepDebtBytes;
 
 	_stats.switchMode(concurrentsweep_mode_stw_find_minimum_free_size, concurrentsweep_mode_on);
 
@@ -1565,6 +1588,51 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep the remaining chunks of all memory pools on behalf of the background sweeper.
+ * Chunks are swept (not connected) in address order so that later free list refills find them ready.  The
+ * sweep stops early when another thread is waiting for exclusive access, so that the background thread never
+ * delays a collection.
+ * @note The caller must hold VM access.
+ * @return true if no sweep work remains, false if the caller stopped for an exclusive access request.
+ */
+bool
+MM_ConcurrentSweepScheme::sweepInBackground(MM_EnvironmentBase *envModron)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	/* Only the mutator phase of the lazy sweep is shared with the background thread */
+	if(concurrentsweep_mode_on != _stats._mode) {
+		return true;
+	}
+
+	bool completed = true;
+	uint64_t startTime = omrtime_hires_clock();
+	increaseActiveSweepingThreadCount(env, false);
+
+	MM_HeapMemoryPoolIterator poolIterator(envModron, _extensions->heap);
+	MM_MemoryPool *memoryPool;
+	while(completed && (NULL != (memoryPool = poolIterator.nextPool()))) {
+		MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+		MM_ParallelSweepChunk *chunk;
+
+		while(NULL != (chunk = getNextSweepChunk(env, sweepState))) {
+			incrementalSweepChunk(env, chunk);
+			_stats._backgroundSweepBytes += chunk->size();
+			if(env->isExclusiveAccessRequestWaiting()) {
+				completed = false;
+				break;
+			}
+		}
+	}
+
+	decreaseActiveSweepingThreadCount(env, false);
+	_stats._backgroundSweepTime += omrtime_hires_clock() - startTime;
+
+	return completed;
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
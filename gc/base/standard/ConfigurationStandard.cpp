@@ -81,6 +81,12 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
+#if defined(OMR_GC_CONCURRENT_SWEEP) && defined(OMR_GC_MODRON_SCAVENGER)
+		/* Lazy sweep of the tenure space is only supported by the flat configuration */
+		if (extensions->scavengerEnabled) {
+			extensions->concurrentSweep = false;
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP && OMR_GC_MODRON_SCAVENGER */
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
 	}
@@ -114,7 +120,7 @@ MM_ConfigurationStandard::initializeGCThreadCount(MM_EnvironmentBase* env)
 MM_GlobalCollector*
 MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 {
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_MODRON_CONCCURENT_SWEEP)
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_CONCURRENT_SWEEP)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK || OMR_GC_CONCURRENT_SWEEP */
 
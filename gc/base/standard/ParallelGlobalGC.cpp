@@ -506,7 +506,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	 */
 	if (_delegate.isAllowUserHeapWalk() || env->_cycleState->_gcCode.isRASDumpGC()) {
 		if (!_fixHeapForWalkCompleted) {
-#if defined(J9VM_GC_MODRON_COMPACTION)
+#if defined(OMR_GC_MODRON_COMPACTION)
 			if (compactedThisCycle) {
 				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 				U_64 startTime = omrtime_hires_clock();
@@ -514,7 +514,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 				_extensions->globalGCStats.fixHeapForWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 				_extensions->globalGCStats.fixHeapForWalkReason = FIXUP_DEBUG_TOOLING;
 			} else
-#endif /* J9VM_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_COMPACTION */
 			{
 				fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 			}
@@ -930,6 +930,13 @@ MM_ParallelGlobalGC::masterThreadSweepComplete(MM_EnvironmentBase *env, SweepCom
 {
 	_sweepScheme->completeSweep(env, reason);
 }
+
+void
+MM_ParallelGlobalGC::completePendingSweep(MM_EnvironmentBase *env)
+{
+	Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
+	masterThreadSweepComplete(env, HEAP_WALK);
+}
 	
 #if defined(OMR_GC_MODRON_COMPACTION)
 void
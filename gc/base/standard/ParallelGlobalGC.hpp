@@ -281,6 +281,13 @@ public:
 	MM_HeapWalker *getHeapWalker() { return _heapWalker; }
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
+	/**
+	 * Finish any sweep work the last collection left behind, so that the heap is walkable and no chunk
+	 * is swept underneath a heap walk until the next collection.
+	 * @note Caller must have exclusive VM access
+	 */
+	virtual void completePendingSweep(MM_EnvironmentBase *env);
+
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 	virtual void heapReconfigured(MM_EnvironmentBase *env);
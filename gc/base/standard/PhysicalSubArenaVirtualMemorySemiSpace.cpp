@@ -87,6 +87,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::initialize(MM_EnvironmentBase *env)
 	
 	_resizable = env->getExtensions()->dynamicNewSpaceSizing;
 	_avoidMovingObjects = env->getExtensions()->dnssAvoidMovingObjects;
+	initializeTransparentHugePages(env, env->getExtensions()->newSpaceTransparentHugePages);
 
 	return true;
 }
@@ -141,6 +142,11 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::inflate(MM_EnvironmentBase *env)
 		}
 	}
 	if(_parent->attachSubArena(env, this, _subSpace->getInitialSize(), attachPolicy)) {
+		if (0 != _transparentHugePageSize) {
+			/* The attach committed the initial range at heap granularity; extend it to whole huge pages and advise it */
+			commitHeapMemory(env, _lowAddress, calculateOffsetToHighAddress(_lowAddress));
+		}
+
 		/* Inflation successful - inform the owning memorySubSpaces semi-spaces */
 		MM_MemorySubSpace *subSpaceAllocate = ((MM_MemorySubSpaceSemiSpace *)_subSpace)->getMemorySubSpaceAllocate();
 		MM_MemorySubSpace *subSpaceSurvivor = ((MM_MemorySubSpaceSemiSpace *)_subSpace)->getMemorySubSpaceSurvivor();
@@ -689,7 +695,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		decommitHeapMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -872,7 +879,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		decommitHeapMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -1229,7 +1237,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress) + splitExpandSize);
 		}
-		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
+		if(!commitHeapMemory(env, newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
@@ -1299,7 +1307,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress)+splitExpandSize);
 		}
-		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
+		if(!commitHeapMemory(env, newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
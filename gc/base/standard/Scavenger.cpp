@@ -105,6 +105,20 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* Work-stealing scan termination state: scan cycle sequence in the high half, idle thread count in the low half */
+#define SCAN_TERMINATION_SEQUENCE_SHIFT 32
+#define SCAN_TERMINATION_IDLE_MASK (((uint64_t)1 << SCAN_TERMINATION_SEQUENCE_SHIFT) - 1)
+/* Number of polls an idle thread makes with only a CPU yield hint, before it starts yielding the processor to other threads */
+#define SCAN_TERMINATION_SPIN_LIMIT 64
+
+/* Upper bound for -Xgc:scavengerPrefetchDepth; deeper pipelines only evict lines before they are used */
+#define SCAVENGER_PREFETCH_DEPTH_MAX 16
+
+/* Upper bound for -Xgc:scavengerHierarchicalCopyDepth, and the number of leading reference slots of each object
+ * that are followed; together they bound the objects copied behind one object to 2^(depth + 1) - 2 */
+#define SCAVENGER_HIERARCHICAL_COPY_DEPTH_MAX 8
+#define SCAVENGER_HIERARCHICAL_COPY_CHILDREN 2
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -240,6 +254,35 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	_prefetchDepth = OMR_MIN(_extensions->scavengerPrefetchDepth, SCAVENGER_PREFETCH_DEPTH_MAX);
+
+	/* Concurrent Scavenger lets mutator threads read objects as soon as they are forwarded, so slots of copied objects are only updated by scanning */
+	if (!IS_CONCURRENT_ENABLED) {
+		_hierarchicalCopyDepth = OMR_MIN(_extensions->scavengerHierarchicalCopyDepth, SCAVENGER_HIERARCHICAL_COPY_DEPTH_MAX);
+	}
+
+	/* Shard the remembered set before any thread allocates a fragment from it */
+	_extensions->rememberedSet.setShardCount(OMR_MAX(1, OMR_MIN(_extensions->rememberedSetShards, OMR_SUBLIST_POOL_MAX_SHARDS)));
+
+	/* Concurrent Scavenger lets mutator threads push to the scan list, so it keeps using the shared list only */
+	_scanCacheWorkStealing = _extensions->scavengerWorkStealing && !IS_CONCURRENT_ENABLED;
+	if (_scanCacheWorkStealing) {
+		_numaLocalStealing = _extensions->numaLocalGC && (1 < _extensions->_numaManager.getAffinityLeaderCount());
+		_scanCacheDequeCount = _extensions->gcThreadCount;
+		_scanCacheDeques = (MM_WorkStealingDeque *)env->getForge()->allocate(_scanCacheDequeCount * sizeof(MM_WorkStealingDeque), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			new(&_scanCacheDeques[i]) MM_WorkStealingDeque();
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			if (!_scanCacheDeques[i].initialize(env, _extensions->scavengerWorkStealingDequeSize, (i + 1) * 0x9E3779B9)) {
+				return false;
+			}
+		}
+	}
+
 
 	/* No thread can use more than _cachesPerThread cache entries at 1 time (flip, tenure, scan, large, possibly deferred)
 	 * So long as (N * _cachesPerThread) cache entries exist,the head of the scan list
@@ -303,6 +346,14 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -368,6 +419,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_rescanThreadsForRememberedObjects = false;
 
 	_doneIndex = 0;
+	_scanTerminationState = 0;
 
 	restoreMasterThreadTenureTLHRemainders(env);
 
@@ -685,6 +737,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
+	finalGCStats->_stealScanCacheCount += scavStats->_stealScanCacheCount;
+	finalGCStats->_stealScanCacheAttemptCount += scavStats->_stealScanCacheAttemptCount;
+	finalGCStats->_scanCacheDequeOverflowCount += scavStats->_scanCacheDequeOverflowCount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	finalGCStats->_flipDiscardBytes += scavStats->_flipDiscardBytes;
@@ -1190,6 +1245,15 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 					/* Update the slot. copy() ensures the object is fully copied */
 					toReturn = isObjectInNewSpace(destinationObjectPtr);
 					*objectPtrIndirect = destinationObjectPtr;
+					if (0 != _hierarchicalCopyDepth) {
+						MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
+						copyChildrenHierarchically(env, destinationObjectPtr, _hierarchicalCopyDepth);
+						/* the copy cache may have been replaced (and queued for scanning) while copying the children; only report it if it is still ours */
+						if ((copyCache != env->_survivorCopyScanCache) && (copyCache != env->_tenureCopyScanCache)) {
+							copyCache = NULL;
+						}
+						env->_effectiveCopyScanCache = copyCache;
+					}
 				}
 			}
 		} else if (isObjectInNewSpace(objectPtr)) {
@@ -1246,6 +1310,36 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	return result;
 }
 
+void
+MM_Scavenger::copyChildrenHierarchically(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t depth)
+{
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+	if (NULL != objectScanner) {
+		uintptr_t children = 0;
+		GC_SlotObject *slotObject = NULL;
+		while ((children < SCAVENGER_HIERARCHICAL_COPY_CHILDREN) && (NULL != (slotObject = objectScanner->getNextSlot()))) {
+			omrobjectptr_t childPtr = slotObject->readReferenceFromSlot();
+			if (isObjectInEvacuateMemory(childPtr)) {
+				children += 1;
+				MM_ForwardedHeader forwardHeader(childPtr);
+				omrobjectptr_t forwardPtr = forwardHeader.getForwardedObject();
+				if (NULL == forwardPtr) {
+					forwardPtr = copy(env, &forwardHeader);
+					if (NULL == forwardPtr) {
+						/* backing out; leave the slot for the scan to deal with */
+						break;
+					}
+					if (1 < depth) {
+						copyChildrenHierarchically(env, forwardPtr, depth - 1);
+					}
+				}
+				slotObject->writeReferenceToSlot(forwardPtr);
+			}
+		}
+	}
+}
+
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr)
 {
@@ -1503,6 +1597,14 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 		copyCache->cacheAlloc = newCacheAlloc;
 		assume0(copyCache->cacheAlloc <= copyCache->cacheTop);
 
+		if (0 != _prefetchDepth) {
+			/* the next copy into this cache will most likely spill into the following cache line */
+			void *nextCacheLine = (void *)((uintptr_t)newCacheAlloc + _cacheLineAlignment);
+			if (nextCacheLine < copyCache->cacheTop) {
+				MM_AtomicOperations::prefetchForWrite(nextCacheLine);
+			}
+		}
+
 		/* object has been copied so if scanning hierarchically set effectiveCopyCache to support aliasing check */
 		env->_effectiveCopyScanCache = copyCache;
 
@@ -1633,6 +1735,55 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::copyAndForwardSlotsWithPrefetch(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	fomrobject_t *pendingSlots[SCAVENGER_PREFETCH_DEPTH_MAX];
+	uintptr_t pendingHead = 0;
+	uintptr_t pendingCount = 0;
+	bool shouldRemember = false;
+	GC_SlotObject pendingSlotObject(env->getOmrVM(), NULL);
+	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
+
+	while (true) {
+		GC_SlotObject *slotObject = objectScanner->getNextSlot();
+		if (NULL != slotObject) {
+			/* start fetching the header of the referent; it is read by copyAndForward() once the slot drains out of the pipeline */
+			omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+			if (isObjectInEvacuateMemory(objectPtr)) {
+				MM_AtomicOperations::prefetch(objectPtr);
+			}
+			uintptr_t pendingTail = pendingHead + pendingCount;
+			if (pendingTail >= _prefetchDepth) {
+				pendingTail -= _prefetchDepth;
+			}
+			pendingSlots[pendingTail] = slotObject->readAddressFromSlot();
+			pendingCount += 1;
+			if (pendingCount < _prefetchDepth) {
+				continue;
+			}
+		} else if (0 == pendingCount) {
+			break;
+		}
+
+		/* pipeline is full (or the scanner is exhausted) - process the oldest pending slot */
+		pendingSlotObject.writeAddressToSlot(pendingSlots[pendingHead]);
+		pendingHead += 1;
+		if (pendingHead == _prefetchDepth) {
+			pendingHead = 0;
+		}
+		pendingCount -= 1;
+
+		shouldRemember |= copyAndForward(env, &pendingSlotObject);
+		if (NULL != *copyCache) {
+			*slotsCopied += 1;
+		}
+		*slotsScanned += 1;
+	}
+
+	return shouldRemember;
+}
+
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
@@ -1678,13 +1829,17 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	if (0 != _prefetchDepth) {
+		shouldRemember = copyAndForwardSlotsWithPrefetch(env, objectScanner, &slotsScanned, &slotsCopied);
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -1875,6 +2030,10 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	if (_scanCacheWorkStealing) {
+		return getNextScanCacheWithStealing(env);
+	}
+
 #if defined(OMR_SCAVENGER_TRACE) || defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 #endif /* OMR_SCAVENGER_TRACE || J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -1944,6 +2103,163 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	return cache;
 }
 
+MM_CopyScanCacheStandard *
+MM_Scavenger::getNextScanCacheWithStealing(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t slaveID = env->getSlaveID();
+
+	while (!shouldAbortScanLoop(env)) {
+		/* LIFO from own deque keeps copy order close to depth first, then overflow entries, then FIFO from peers */
+		if (slaveID < _scanCacheDequeCount) {
+			cache = (MM_CopyScanCacheStandard *)_scanCacheDeques[slaveID].pop();
+		}
+		if ((NULL == cache) && (0 != _cachedEntryCount)) {
+			cache = getNextScanCacheFromList(env);
+		}
+		if ((NULL == cache) && (1 < threadCount)) {
+			cache = stealScanCache(env, threadCount);
+		}
+		if (NULL != cache) {
+#if defined(OMR_SCAVENGER_TRACE)
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			omrtty_printf("{SCAV: slaveID %zu Scan cache from deque (%p)}\n", slaveID, cache);
+#endif /* OMR_SCAVENGER_TRACE */
+			break;
+		}
+
+		if (offerScanTermination(env, threadCount)) {
+			break;
+		}
+	}
+
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env, uintptr_t threadCount)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t slaveID = env->getSlaveID();
+	uintptr_t victimCount = OMR_MIN(threadCount, _scanCacheDequeCount);
+
+	if ((slaveID < _scanCacheDequeCount) && (1 < victimCount)) {
+		/* with -Xgc:numaLocalGC, peers on this thread's node are tried before peers on other nodes (the master has no node preference) */
+		uintptr_t passCount = _numaLocalStealing ? 2 : 1;
+		uintptr_t nodeID = _extensions->_numaManager.getGCThreadNodeID(slaveID);
+		/* start from a random peer, and then try the others in order */
+		uintptr_t firstVictim = _scanCacheDeques[slaveID].nextVictim(victimCount);
+		for (uintptr_t pass = 0; (pass < passCount) && (NULL == cache); pass++) {
+			uintptr_t victim = firstVictim;
+			for (uintptr_t i = 0; (i < victimCount) && (NULL == cache); i++) {
+				if ((victim != slaveID) && ((1 == passCount) || ((0 == pass) == (nodeID == _extensions->_numaManager.getGCThreadNodeID(victim))))) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_scavengerStats._stealScanCacheAttemptCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					cache = (MM_CopyScanCacheStandard *)_scanCacheDeques[victim].steal();
+				}
+				victim += 1;
+				if (victim == victimCount) {
+					victim = 0;
+				}
+			}
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (NULL != cache) {
+			env->_scavengerStats._stealScanCacheCount += 1;
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	return cache;
+}
+
+bool
+MM_Scavenger::isScanWorkVisible(uintptr_t threadCount)
+{
+	if (0 != _cachedEntryCount) {
+		return true;
+	}
+	uintptr_t dequeCount = OMR_MIN(threadCount, _scanCacheDequeCount);
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		if (!_scanCacheDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+MM_Scavenger::offerScanTermination(MM_EnvironmentStandard *env, uintptr_t threadCount)
+{
+	bool doneFlag = false;
+
+	/* buffers have to be flushed before other threads can conclude the scan loop is done */
+	flushBuffersForGetNextScanCache(env);
+
+	uint64_t state = MM_AtomicOperations::addU64(&_scanTerminationState, 1);
+	uint64_t sequence = state >> SCAN_TERMINATION_SEQUENCE_SHIFT;
+
+	if (threadCount == (state & SCAN_TERMINATION_IDLE_MASK)) {
+		/* last thread to go idle: no thread holds any work, nor can create it - end this scan cycle */
+		_doneIndex += 1;
+		_extensions->copyScanRatio.reset(env, false);
+		MM_AtomicOperations::writeBarrier();
+		uint64_t nextState = (sequence + 1) << SCAN_TERMINATION_SEQUENCE_SHIFT;
+		uint64_t oldState = MM_AtomicOperations::lockCompareExchangeU64(&_scanTerminationState, state, nextState);
+		Assert_MM_true(oldState == state);
+		return true;
+	}
+
+	MM_AtomicOperations::add(&_waitingCount, 1);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	uintptr_t spinCount = 0;
+	while (true) {
+#if defined(OMR_ENV_DATA64)
+		state = _scanTerminationState;
+#else /* OMR_ENV_DATA64 */
+		/* 64 bit loads are not atomic here */
+		state = MM_AtomicOperations::lockCompareExchangeU64(&_scanTerminationState, 0, 0);
+#endif /* OMR_ENV_DATA64 */
+		if (sequence != (state >> SCAN_TERMINATION_SEQUENCE_SHIFT)) {
+			doneFlag = true;
+			break;
+		}
+		if (threadCount != (state & SCAN_TERMINATION_IDLE_MASK)) {
+			if (isScanWorkVisible(threadCount) || shouldAbortScanLoop(env)) {
+				/* withdraw the offer; fails if the idle count or sequence changed meanwhile, so just retry */
+				if (state == MM_AtomicOperations::lockCompareExchangeU64(&_scanTerminationState, state, state - 1)) {
+					break;
+				}
+				continue;
+			}
+		}
+		if (spinCount < SCAN_TERMINATION_SPIN_LIMIT) {
+			spinCount += 1;
+			MM_AtomicOperations::yieldCPU();
+		} else {
+			omrthread_yield();
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	uint64_t waitEndTime = omrtime_hires_clock();
+	if (doneFlag) {
+		env->_scavengerStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+	} else {
+		env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	MM_AtomicOperations::subtract(&_waitingCount, 1);
+
+	return doneFlag;
+}
+
 /**
  * Scans all the objects to scan in the scanCache, remembering objects as required,
  * and flushing the cache at the end.
@@ -2585,7 +2901,7 @@ MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(env, puddle))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -2620,7 +2936,7 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(env, puddle))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -2662,7 +2978,7 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 
 	/* Remembered set walk */
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(env, puddle))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -3133,6 +3449,19 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
+	if (_scanCacheWorkStealing) {
+		/* idle threads poll the deques, there is nobody to notify */
+		uintptr_t slaveID = env->getSlaveID();
+		if ((slaveID < _scanCacheDequeCount) && _scanCacheDeques[slaveID].push(newCacheEntry)) {
+			return;
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_scavengerStats._scanCacheDequeOverflowCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+		return;
+	}
+
 	_scavengeCacheScanList.pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
@@ -3623,6 +3952,11 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+				while (NULL != (cache = (MM_CopyScanCacheStandard *)_scanCacheDeques[i].steal())) {
+					flushCache(env, cache);
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -3779,6 +4113,11 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
+	if (1 < _extensions->rememberedSet.getShardCount()) {
+		MM_ScavengerStats *incrementStats = &_extensions->incrementScavengerStats;
+		incrementStats->_rememberedSetShardCount = _extensions->rememberedSet.getShardCount();
+		_extensions->rememberedSet.countShardElements(incrementStats->_rememberedSetShardSizes);
+	}
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
@@ -42,6 +42,7 @@
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "WorkStealingDeque.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -110,6 +111,13 @@ private:
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
+	bool _scanCacheWorkStealing; /**< true if scan work is distributed through _scanCacheDeques (-Xgc:scavengerWorkStealing, not supported with Concurrent Scavenger) */
+	bool _numaLocalStealing; /**< true if scan caches are stolen from threads on the same NUMA node before other nodes (-Xgc:numaLocalGC with more than one node) */
+	MM_WorkStealingDeque *_scanCacheDeques; /**< per GC thread deques of scan caches, indexed by slave ID; the shared scan list is used for overflow */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
+	volatile uint64_t _scanTerminationState; /**< work-stealing termination: scan cycle sequence in the high 32 bits, count of idle threads in the low 32 bits */
+	uintptr_t _prefetchDepth; /**< number of slots kept in flight by the prefetching slot scan loop, at most SCAVENGER_PREFETCH_DEPTH_MAX; 0 if prefetching is disabled */
+	uintptr_t _hierarchicalCopyDepth; /**< number of generations of children copied right behind each copied object, at most SCAVENGER_HIERARCHICAL_COPY_DEPTH_MAX; 0 if copy order is breadth-first */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
@@ -241,6 +249,37 @@ public:
 
 	MM_CopyScanCacheStandard *getNextScanCache(MM_EnvironmentStandard *env);
 
+	/**
+	 * Work-stealing flavour of the tail of getNextScanCache(): take work from this thread's deque,
+	 * the shared (overflow) scan list, or steal from another thread, and otherwise take part in
+	 * lock-free termination detection.
+	 * @param env - current thread environment
+	 * @return a scan cache, or NULL if all threads agreed there is no scan work left (or the scan loop is aborted)
+	 */
+	MM_CopyScanCacheStandard *getNextScanCacheWithStealing(MM_EnvironmentStandard *env);
+
+	/**
+	 * Try to steal a scan cache from the deque of another GC thread, starting from a random victim.
+	 * @param env - current thread environment
+	 * @param threadCount - number of GC threads participating in the current task
+	 * @return a stolen scan cache, or NULL
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env, uintptr_t threadCount);
+
+	/**
+	 * Racy check if any scan work is visible in the deques or the shared scan list.
+	 */
+	bool isScanWorkVisible(uintptr_t threadCount);
+
+	/**
+	 * Declare the current thread idle and spin until either all GC threads are idle (scan loop is done)
+	 * or some scan work becomes visible (or the scan loop is aborted), in which case the offer is withdrawn.
+	 * @param env - current thread environment
+	 * @param threadCount - number of GC threads participating in the current task
+	 * @return true if the scan loop is done
+	 */
+	bool offerScanTermination(MM_EnvironmentStandard *env, uintptr_t threadCount);
+
 	/**
 	 * Implementation of CopyAndForward for slotObject input format
 	 * @param slotObject input field in slotObject format
@@ -251,7 +290,29 @@ public:
 
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
+	/**
+	 * Copy the objects referenced by the first SCAVENGER_HIERARCHICAL_COPY_CHILDREN reference slots of a copied
+	 * object, and recursively their children up to the given depth, so that they land right behind their parent
+	 * in the copy cache. The slots of the copied object are updated to the new locations; any slot that is not
+	 * handled here is handled when the object is scanned.
+	 * @param env The environment.
+	 * @param objectPtr the new location of an object copied by this thread
+	 * @param depth number of generations of children to copy, at least 1
+	 */
+	void copyChildrenHierarchically(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t depth);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
+
+	/**
+	 * Copy and forward all remaining slots of an object, keeping _prefetchDepth slots in flight: the referent
+	 * of each slot is prefetched when the slot is returned by the scanner, and copied _prefetchDepth slots later.
+	 * @param env The environment.
+	 * @param objectScanner scanner positioned on the slots to process
+	 * @param slotsScanned[out] incremented by the number of slots processed
+	 * @param slotsCopied[out] incremented by the number of slots for which an object was copied
+	 * @return true if any slot refers to an object in new space after processing
+	 */
+	MMINLINE bool copyAndForwardSlotsWithPrefetch(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
 	/**
@@ -811,6 +872,13 @@ public:
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
 		, _waitingCount(0)
+		, _scanCacheWorkStealing(false)
+		, _numaLocalStealing(false)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
+		, _scanTerminationState(0)
+		, _prefetchDepth(0)
+		, _hierarchicalCopyDepth(0)
 		, _cacheLineAlignment(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
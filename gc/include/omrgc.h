@@ -42,6 +42,9 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Write the allocation sampling histogram (-Xgc:allocationSampling) to fd, an omrfile_open() descriptor or OMRPORT_TTY_OUT/ERR */
+omr_error_t OMR_GC_DumpAllocationSamples(OMR_VMThread* omrVMThread, intptr_t fd);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -60,3 +60,17 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_DumpAllocationSamples(OMR_VMThread* omrVMThread, intptr_t fd)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->allocationSampling) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		extensions->allocationSamplingStats.dump(env, fd, extensions->allocationSamplingInterval);
+	}
+	return result;
+}
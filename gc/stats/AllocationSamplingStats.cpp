@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <math.h>
+
+#include "omrport.h"
+
+#include "AllocationSamplingStats.hpp"
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+
+uintptr_t
+MM_AllocationSamplingStats::nextSampleInterval(uint64_t *seed, uintptr_t meanInterval)
+{
+	/* xorshift64* */
+	uint64_t x = *seed;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*seed = x;
+	x *= (uint64_t)0x2545F4914F6CDD1DULL;
+
+	/* uniform in (0, 1] from the top 53 bits, so that the logarithm is finite */
+	double uniform = ((double)(x >> 11) + 1.0) / 9007199254740992.0;
+	double interval = -log(uniform) * (double)meanInterval;
+	if (interval < 1.0) {
+		interval = 1.0;
+	} else if (interval > (double)(UDATA_MAX >> 1)) {
+		interval = (double)(UDATA_MAX >> 1);
+	}
+	return (uintptr_t)interval;
+}
+
+uintptr_t
+MM_AllocationSamplingStats::estimateSampledBytes(uintptr_t size, uintptr_t meanInterval)
+{
+	/* an object of this size is sampled if at least one of its bytes ends an interval */
+	double probability = 1.0 - exp(-(double)size / (double)meanInterval);
+	return (uintptr_t)((double)size / probability);
+}
+
+void
+MM_AllocationSamplingStats::recordSample(uintptr_t size, uintptr_t estimatedBytes)
+{
+	uintptr_t sizeClass = getSizeClass(size);
+	MM_AtomicOperations::add(&_sampleCount[sizeClass], 1);
+	MM_AtomicOperations::addU64(&_sampledBytes[sizeClass], size);
+	MM_AtomicOperations::addU64(&_estimatedBytes[sizeClass], estimatedBytes);
+}
+
+void
+MM_AllocationSamplingStats::dump(MM_EnvironmentBase *env, intptr_t fd, uintptr_t meanInterval)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	uintptr_t totalSamples = 0;
+	uint64_t totalEstimatedBytes = 0;
+	for (uintptr_t sizeClass = 0; sizeClass < ALLOCATION_SAMPLING_SIZE_CLASSES; sizeClass++) {
+		totalSamples += _sampleCount[sizeClass];
+		totalEstimatedBytes += _estimatedBytes[sizeClass];
+	}
+
+	omrfile_printf(fd, "Allocation samples: mean interval %zu bytes, %zu samples, %llu bytes estimated\n",
+		meanInterval, totalSamples, totalEstimatedBytes);
+	omrfile_printf(fd, "%20s %20s %12s %20s %20s %7s\n", "size from", "size to", "samples", "sampled bytes", "estimated bytes", "share");
+	for (uintptr_t sizeClass = 0; sizeClass < ALLOCATION_SAMPLING_SIZE_CLASSES; sizeClass++) {
+		uintptr_t samples = _sampleCount[sizeClass];
+		if (0 != samples) {
+			uint64_t estimatedBytes = _estimatedBytes[sizeClass];
+			uint64_t from = (uint64_t)1 << sizeClass;
+			omrfile_printf(fd, "%20llu %20llu %12zu %20llu %20llu %6.2f%%\n",
+				from, (from << 1) - 1, samples, (uint64_t)_sampledBytes[sizeClass], estimatedBytes,
+				(100.0 * (double)estimatedBytes) / (double)totalEstimatedBytes);
+		}
+	}
+}
+
+void
+MM_AllocationSamplingStats::clear()
+{
+	for (uintptr_t sizeClass = 0; sizeClass < ALLOCATION_SAMPLING_SIZE_CLASSES; sizeClass++) {
+		_sampleCount[sizeClass] = 0;
+		_sampledBytes[sizeClass] = 0;
+		_estimatedBytes[sizeClass] = 0;
+	}
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONSAMPLINGSTATS_HPP_)
+#define ALLOCATIONSAMPLINGSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "Base.hpp"
+#include "Math.hpp"
+
+class MM_EnvironmentBase;
+
+/* Number of power of two object size classes in the allocation sampling histogram */
+#define ALLOCATION_SAMPLING_SIZE_CLASSES (sizeof(uintptr_t) * 8)
+
+/**
+ * Histogram, by power of two object size class, of the allocation samples taken by all threads
+ * (see MM_EnvironmentBase::sampleAllocation()).  Samples are rare, so they are recorded directly
+ * with atomic updates rather than being merged from per thread copies.
+ */
+class MM_AllocationSamplingStats : public MM_Base
+{
+private:
+public:
+	volatile uintptr_t _sampleCount[ALLOCATION_SAMPLING_SIZE_CLASSES]; /**< Number of objects sampled in each size class */
+	volatile uint64_t _sampledBytes[ALLOCATION_SAMPLING_SIZE_CLASSES]; /**< Total size of the objects sampled in each size class */
+	volatile uint64_t _estimatedBytes[ALLOCATION_SAMPLING_SIZE_CLASSES]; /**< Estimated number of bytes allocated in each size class */
+
+	/**
+	 * @param size an object size in bytes, greater than 0
+	 * @return the histogram size class holding objects of the given size: [2^sizeClass, 2^(sizeClass+1))
+	 */
+	static MMINLINE uintptr_t getSizeClass(uintptr_t size) { return MM_Math::floorLog2(size); }
+
+	/**
+	 * Draw the number of bytes to allocate before the next sample.  The intervals are exponentially
+	 * distributed (the continuous form of a geometric distribution) so that every allocated byte is
+	 * equally likely to be picked regardless of the allocation pattern.
+	 * @param[in,out] seed state of the calling thread's random number generator, never 0
+	 * @param meanInterval the mean interval, in bytes
+	 * @return the interval, in bytes, at least 1
+	 */
+	static uintptr_t nextSampleInterval(uint64_t *seed, uintptr_t meanInterval);
+
+	/**
+	 * Estimate the number of bytes allocated that a sample of the given size stands for: the size
+	 * divided by the probability that an object of this size is sampled.
+	 * @param size the size of the sampled object, in bytes
+	 * @param meanInterval the mean sampling interval, in bytes
+	 * @return the estimate, in bytes
+	 */
+	static uintptr_t estimateSampledBytes(uintptr_t size, uintptr_t meanInterval);
+
+	void recordSample(uintptr_t size, uintptr_t estimatedBytes);
+
+	/**
+	 * Write the histogram as text.
+	 * @param fd a file descriptor opened with omrfile_open(), or OMRPORT_TTY_OUT / OMRPORT_TTY_ERR
+	 * @param meanInterval the mean sampling interval, in bytes
+	 */
+	void dump(MM_EnvironmentBase *env, intptr_t fd, uintptr_t meanInterval);
+
+	/**
+	 * Reset the histogram.  Samples recorded concurrently may be lost.
+	 */
+	void clear();
+
+	MM_AllocationSamplingStats()
+		: MM_Base()
+	{
+		clear();
+	}
+};
+
+#endif /* ALLOCATIONSAMPLINGSTATS_HPP_ */
@@ -40,6 +40,7 @@ public:
 	uintptr_t _tlhAllocatedReused; /**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
+	uintptr_t _tlhWastedBytes; /**< The amount of memory left over in TLHs that were too small to cache when they were refreshed. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
@@ -87,6 +88,7 @@ public:
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
+		_tlhWastedBytes(0),
 		_tlhMaxAbandonedListSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
@@ -48,6 +48,8 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+	_incrementWindowBytes = 0;
+	_incrementHeapBytes = 0;
 };
 
 void
@@ -56,6 +58,11 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	/* the increment is selected by the master thread alone, so copy its sizes rather than summing them */
+	if (0 != statsToMerge->_incrementWindowBytes) {
+		_incrementWindowBytes = statsToMerge->_incrementWindowBytes;
+		_incrementHeapBytes = statsToMerge->_incrementHeapBytes;
+	}
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
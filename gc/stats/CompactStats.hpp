@@ -58,6 +58,8 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+	uintptr_t _incrementWindowBytes; /**< Bytes of heap in the window evacuated by an incremental compaction, 0 if the whole heap was compacted */
+	uintptr_t _incrementHeapBytes; /**< Bytes of heap a full compaction would have evacuated, for an incremental compaction */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
@@ -96,6 +96,19 @@ public:
 	 * @}
 	 */
 
+	/**
+	 * Lazy sweep debt statistics.
+	 * @{
+	 */
+	uintptr_t _sweepDebtBytes;  /**< Heap bytes left unconnected when the mutators resumed after the STW sweep */
+	volatile uintptr_t _allocationSweepBytes;  /**< Bytes swept by allocating threads (free list refills and allocation tax) */
+	volatile uint64_t _allocationSweepTime;  /**< Time, in hi-res ticks, allocating threads spent sweeping and connecting */
+	uintptr_t _backgroundSweepBytes;  /**< Bytes swept by the background sweeper thread */
+	uint64_t _backgroundSweepTime;  /**< Time, in hi-res ticks, the background sweeper thread spent sweeping */
+	/**
+	 * @}
+	 */
+
 	/**
 	 * Force the concurrent sweep mode into a particular state.
 	 * @note This routine should only be used for initialization or clearing.
@@ -154,6 +167,11 @@ public:
 		_completeConnectPhaseTimeStart = 0;
 		_completeConnectPhaseTimeEnd = 0;
 		_completeConnectPhaseBytesConnected = 0;
+		_sweepDebtBytes = 0;
+		_allocationSweepBytes = 0;
+		_allocationSweepTime = 0;
+		_backgroundSweepBytes = 0;
+		_backgroundSweepTime = 0;
 	}
 
 	MM_ConcurrentSweepStats() :
@@ -171,7 +189,12 @@ public:
 		_completeSweepPhaseBytesSwept(0),
 		_completeConnectPhaseTimeStart(0),
 		_completeConnectPhaseTimeEnd(0),
-		_completeConnectPhaseBytesConnected(0)
+		_completeConnectPhaseBytesConnected(0),
+		_sweepDebtBytes(0),
+		_allocationSweepBytes(0),
+		_allocationSweepTime(0),
+		_backgroundSweepBytes(0),
+		_backgroundSweepTime(0)
 	{}
 };
 
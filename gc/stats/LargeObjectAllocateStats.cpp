@@ -639,6 +639,10 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+
+	_freeListSearchCount = 0;
+	_freeListSearchLength = 0;
+	_freeListSearchLengthMax = 0;
 }
 
 void
@@ -686,6 +690,10 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	_freeListSearchCount += statsToMerge->_freeListSearchCount;
+	_freeListSearchLength += statsToMerge->_freeListSearchLength;
+	_freeListSearchLengthMax = OMR_MAX(_freeListSearchLengthMax, statsToMerge->_freeListSearchLengthMax);
 }
 
 void
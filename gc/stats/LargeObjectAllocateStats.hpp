@@ -179,6 +179,10 @@ private:
 	uintptr_t _freeMemoryBeforeEstimate;					 /**< initial free memory before estimateFragmentation */
 	uintptr_t _maxHeapSize;
 
+	uintptr_t _freeListSearchCount; /**< number of free list searches for object allocates since the last resetCurrent() */
+	uintptr_t _freeListSearchLength; /**< total number of free entries stepped over by those searches */
+	uintptr_t _freeListSearchLengthMax; /**< number of free entries stepped over by the longest of those searches */
+
 	uintptr_t _TLHSizeClassIndex; /**< preserved next value of sizeClassIndex on last invocation of simulateAllocateTLHs */
 	uintptr_t _TLHFrequentAllocationSize;/**< preserved next value of FrequentAllocationSize on last invocation of simulateAllocateTLHs */
 
@@ -235,6 +239,23 @@ public:
 	 */
 	void allocateObject(uintptr_t allocateSize);
 
+	/**
+	 * Invoked by allocator after searching a free list for an object allocate, successful or not.
+	 * @param searchLength number of free entries stepped over before a fit was found (or the list ended)
+	 */
+	MMINLINE void recordFreeListSearch(uintptr_t searchLength)
+	{
+		_freeListSearchCount += 1;
+		_freeListSearchLength += searchLength;
+		if (searchLength > _freeListSearchLengthMax) {
+			_freeListSearchLengthMax = searchLength;
+		}
+	}
+
+	uintptr_t getFreeListSearchCount() { return _freeListSearchCount; }
+	uintptr_t getFreeListSearchLength() { return _freeListSearchLength; }
+	uintptr_t getFreeListSearchLengthMax() { return _freeListSearchLengthMax; }
+
 	/**
 	 * Merge CURRENT this/these stats with provided stats. The result is stored back into this stats
      * @param statsToMerge to be added to this stats
@@ -348,6 +369,9 @@ public:
 		_remainingFreeMemoryAfterEstimate(0),
 		_freeMemoryBeforeEstimate(0),
 		_maxHeapSize(0),
+		_freeListSearchCount(0),
+		_freeListSearchLength(0),
+		_freeListSearchLengthMax(0),
 		_TLHSizeClassIndex(0),
 		_TLHFrequentAllocationSize(0)
 	{
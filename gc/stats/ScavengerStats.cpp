@@ -55,6 +55,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_aliasToCopyCacheCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
+	,_stealScanCacheCount(0)
+	,_stealScanCacheAttemptCount(0)
+	,_scanCacheDequeOverflowCount(0)
 	,_workStallCount(0)
 	,_completeStallCount(0)
 	,_syncStallCount(0)
@@ -83,6 +86,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
+	,_rememberedSetShardCount(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
@@ -96,6 +100,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_rememberedSetShardSizes, 0, sizeof(_rememberedSetShardSizes));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -157,6 +162,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
+	_stealScanCacheCount = 0;
+	_stealScanCacheAttemptCount = 0;
+	_scanCacheDequeOverflowCount = 0;
 	_workStallCount = 0;
 	_completeStallCount = 0;
 	_syncStallCount = 0;
@@ -182,6 +190,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_rememberedSetShardCount = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
@@ -86,6 +86,9 @@ public:
 	uintptr_t _aliasToCopyCacheCount;
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
+	uintptr_t _stealScanCacheCount; /**< The number of scan caches stolen from other threads' deques (-Xgc:scavengerWorkStealing) */
+	uintptr_t _stealScanCacheAttemptCount; /**< The number of steal attempts on other threads' deques, successful or not */
+	uintptr_t _scanCacheDequeOverflowCount; /**< The number of scan caches pushed to the shared scan list because the thread's deque was full */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -128,6 +131,9 @@ public:
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
+	uintptr_t _rememberedSetShardCount; /**< Number of entries of _rememberedSetShardSizes that are valid; 0 unless the remembered set is sharded */
+	uintptr_t _rememberedSetShardSizes[OMR_SUBLIST_POOL_MAX_SHARDS]; /**< Number of remembered set entries held by each shard at the end of the scavenge */
+
 	uint64_t _leafObjectCount;
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
@@ -37,6 +37,11 @@ MM_SweepStats::clear()
 {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
+	sweepDebtBytes = 0;
+	allocationSweepBytes = 0;
+	allocationSweepTime = 0;
+	backgroundSweepBytes = 0;
+	completeSweepBytes = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -51,6 +56,11 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
+	sweepDebtBytes += statsToMerge->sweepDebtBytes;
+	allocationSweepBytes += statsToMerge->allocationSweepBytes;
+	allocationSweepTime += statsToMerge->allocationSweepTime;
+	backgroundSweepBytes += statsToMerge->backgroundSweepBytes;
+	completeSweepBytes += statsToMerge->completeSweepBytes;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
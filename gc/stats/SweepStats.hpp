@@ -42,6 +42,11 @@ public:
 	
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
+	uintptr_t sweepDebtBytes;  /**< Heap bytes left for lazy sweeping when the mutators resume */
+	uintptr_t allocationSweepBytes;  /**< Bytes of the previous cycle's debt swept by allocating threads */
+	uint64_t allocationSweepTime;  /**< Time, in hi-res ticks, allocating threads spent paying the previous cycle's debt */
+	uintptr_t backgroundSweepBytes;  /**< Bytes of the previous cycle's debt swept by the background sweeper */
+	uintptr_t completeSweepBytes;  /**< Bytes of the previous cycle's debt still unswept when this collection started */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
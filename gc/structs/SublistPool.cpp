@@ -50,6 +50,7 @@ MM_SublistPool::initialize(MM_EnvironmentBase *env, OMR::GC::AllocationCategory:
 {
 	memset(this, 0, sizeof(*this));
 	_allocCategory = category;
+	_shardCount = 1;
 	return (!omrthread_monitor_init_with_name(&_mutex, 0, "MM_SublistPool"));
 }
 
@@ -66,7 +67,9 @@ MM_SublistPool::tearDown(MM_EnvironmentBase *env)
 
 	/* Free all puddles associated to the sublist */
 	freePuddles(env, _list);
-	freePuddles(env, _previousList);
+	for (uintptr_t shard = 0; shard < OMR_SUBLIST_POOL_MAX_SHARDS; shard++) {
+		freePuddles(env, _previousLists[shard]);
+	}
 }
 
 void
@@ -131,6 +134,10 @@ MM_SublistPool::allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment)
 	uintptr_t puddleSize = 0;
 	MM_SublistPuddle *emptyPuddle = NULL;
 
+	if (1 < _shardCount) {
+		return allocateFromShard(env, fragment, getShard(env));
+	}
+
 	/* Attempt to allocate a fragment from the current allocation puddle. If successful, we are done. */
 	if(_allocPuddle && _allocPuddle->allocate(fragment)) {
 		return true;
@@ -216,6 +223,85 @@ MM_SublistPool::allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment)
 	return true;
 }
 
+/**
+ * Find the shard used by the thread.
+ * Shards are selected by environment id rather than by a hash of the remembered object's address: fragments
+ * are thread-local, so every entry a thread adds goes through the one puddle its fragment came from anyway.
+ * GC threads are attached one after the other, so with at least as many shards as GC threads each of
+ * them gets its own shard.
+ */
+uintptr_t
+MM_SublistPool::getShard(MM_EnvironmentBase *env)
+{
+	return env->getEnvironmentId() % _shardCount;
+}
+
+/**
+ * Allocate a new fragment from the allocation puddle of a shard.
+ * Refilling a fragment from the shard's puddle is a lock-free bump of that puddle, so threads on different
+ * shards don't contend. When the shard's puddle is full, replacing it still takes the sublist _mutex, shared
+ * by all shards: the shard is given the next empty puddle, which becomes the tail of the list (_allocPuddle).
+ * The puddles previously filled by the shards stay in the list, possibly partially full, until the list
+ * is compacted.
+ *
+ * @return true if the fragment allocate is successful, false otherwise.
+ */
+bool
+MM_SublistPool::allocateFromShard(MM_EnvironmentBase *env, MM_SublistFragment *fragment, uintptr_t shard)
+{
+	MM_SublistPuddle *shardPuddle = _shardAllocPuddles[shard];
+	if ((NULL != shardPuddle) && shardPuddle->allocate(fragment)) {
+		return true;
+	}
+
+	omrthread_monitor_enter(_mutex);
+
+	/* Another thread of the shard may have installed a new puddle while attempting to get the lock */
+	shardPuddle = _shardAllocPuddles[shard];
+	if ((NULL != shardPuddle) && shardPuddle->allocate(fragment)) {
+		omrthread_monitor_exit(_mutex);
+		return true;
+	}
+
+	/* An empty alloc puddle (as left by startProcessingSublist()) isn't used by any shard, since a shard
+	 * allocates from its puddle before exposing it. Puddles past the alloc puddle are guaranteed to be empty.
+	 */
+	MM_SublistPuddle *emptyPuddle = NULL;
+	if (NULL != _allocPuddle) {
+		emptyPuddle = _allocPuddle->isEmpty() ? _allocPuddle : _allocPuddle->getNext();
+	}
+	if (NULL != emptyPuddle) {
+		Assert_MM_true(emptyPuddle->isEmpty());
+	} else {
+		emptyPuddle = createNewPuddle(env);
+		if (NULL == emptyPuddle) {
+			omrthread_monitor_exit(_mutex);
+			return false;
+		}
+		_currentSize += emptyPuddle->totalSize();
+
+		/* Add the puddle to the tail of the list (a non-empty list always has an _allocPuddle) */
+		if (NULL == _list) {
+			Assert_MM_true(NULL == _allocPuddle);
+			_list = emptyPuddle;
+		} else {
+			Assert_MM_true(NULL == _allocPuddle->getNext());
+			_allocPuddle->setNext(emptyPuddle);
+		}
+	}
+	_allocPuddle = emptyPuddle;
+
+	/* Allocate the fragment before exposing the puddle to the other threads of the shard */
+	emptyPuddle->setShard(shard);
+	bool mustSucceed = emptyPuddle->allocate(fragment);
+	Assert_MM_true(mustSucceed);
+	_shardAllocPuddles[shard] = emptyPuddle;
+
+	omrthread_monitor_exit(_mutex);
+
+	return true;
+}
+
 /**
  * Allocate a single entry in the sublist.
  * 
@@ -270,6 +356,9 @@ MM_SublistPool::compact(MM_EnvironmentBase *env)
 	MM_SublistPuddle *sourcePuddle, *destinationPuddle;
 	MM_SublistPuddle *lastPuddle = NULL;
 
+	/* Puddles may be merged or freed; the shards get new puddles on their next allocate */
+	resetShardAllocPuddles();
+
 	/* Use the list of puddles to iterate through and reset the list pointer to NULL
 	 * as we will add puddles back
 	 */
@@ -382,11 +471,14 @@ MM_SublistPool::clear(MM_EnvironmentBase *env)
 
 	/* Free the puddles and reset the lists to NULL */
 	freePuddles(env, _list);
-	freePuddles(env, _previousList);
+	for (uintptr_t shard = 0; shard < OMR_SUBLIST_POOL_MAX_SHARDS; shard++) {
+		freePuddles(env, _previousLists[shard]);
+		_previousLists[shard] = NULL;
+	}
 
 	_list = NULL;
 	_allocPuddle = NULL;
-	_previousList = NULL;
+	resetShardAllocPuddles();
 	_count = 0;
 }
 
@@ -401,11 +493,28 @@ MM_SublistPool::countElements()
 	return _count;
 }
 
+void
+MM_SublistPool::countShardElements(uintptr_t *shardCounts)
+{
+	memset(shardCounts, 0, _shardCount * sizeof(uintptr_t));
+
+	for (MM_SublistPuddle *puddle = _list; NULL != puddle; puddle = puddle->getNext()) {
+		shardCounts[puddle->getShard()] += puddle->consumedSize() / sizeof(uintptr_t);
+	}
+	for (uintptr_t shard = 0; shard < _shardCount; shard++) {
+		for (MM_SublistPuddle *puddle = _previousLists[shard]; NULL != puddle; puddle = puddle->getNext()) {
+			shardCounts[shard] += puddle->consumedSize() / sizeof(uintptr_t);
+		}
+	}
+}
+
 void
 MM_SublistPool::startProcessingSublist() 
 {
-	Assert_MM_true(NULL == _previousList);
-	_previousList = _list;
+	for (uintptr_t shard = 0; shard < _shardCount; shard++) {
+		Assert_MM_true(NULL == _previousLists[shard]);
+	}
+	MM_SublistPuddle *previousList = _list;
 
 	MM_SublistPuddle* tail = _allocPuddle;
 	if (NULL == tail) {
@@ -419,10 +528,23 @@ MM_SublistPool::startProcessingSublist()
 		/* if there is an _allocPuddle it must be empty at this point */
 		Assert_MM_true( (NULL == _allocPuddle) || (_allocPuddle->isEmpty()) ); 
 	}
+
+	/* The shards' puddles are about to be processed; entries added from now on go to new puddles */
+	resetShardAllocPuddles();
+
+	/* Chain the puddles by the shard that filled them */
+	while (NULL != previousList) {
+		MM_SublistPuddle *puddle = previousList;
+		previousList = puddle->getNext();
+		uintptr_t shard = puddle->getShard();
+		Assert_MM_true(shard < _shardCount);
+		puddle->setNext(_previousLists[shard]);
+		_previousLists[shard] = puddle;
+	}
 }
 
 MM_SublistPuddle *
-MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
+MM_SublistPool::popPreviousPuddle(MM_EnvironmentBase *env, MM_SublistPuddle * returnedPuddle)
 {
 	omrthread_monitor_enter(_mutex);
 
@@ -441,11 +563,16 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 		}
 	}
 
-	/* pop an element from the previous list */
-	MM_SublistPuddle *result = _previousList;
-	if (NULL != result) {
-		_previousList = result->getNext();
-		result->setNext(NULL);
+	/* pop an element from the previous lists, starting with the caller's shard */
+	MM_SublistPuddle *result = NULL;
+	uintptr_t shard = getShard(env);
+	for (uintptr_t i = 0; (NULL == result) && (i < _shardCount); i++) {
+		result = _previousLists[shard];
+		if (NULL != result) {
+			_previousLists[shard] = result->getNext();
+			result->setNext(NULL);
+		}
+		shard = (shard + 1) % _shardCount;
 	}
 	
 	omrthread_monitor_exit(_mutex);
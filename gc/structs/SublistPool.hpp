@@ -32,6 +32,9 @@
 #include "omrcomp.h"
 #include "omrthread.h"
 #include "modronbase.h"
+#include "omrgcconsts.h"
+
+#include <string.h>
 
 #include "AtomicOperations.hpp"
 #include "Forge.hpp"
@@ -48,6 +51,10 @@ class GC_SublistIterator;
  * more <i>puddles</i> (instances of MM_SublistPuddle). A thread can reserve a block
  * of memory from the list (an instance of MM_SublistFragment), and then operate without
  * contention on that fragment.
+ * The pool may be split into shards (see #setShardCount()), selected by the environment id of the allocating
+ * thread. Each shard has its own allocation puddle, so threads on different shards refill their fragments
+ * without touching the same puddle, and the puddles handed out by #popPreviousPuddle() are kept in per-shard
+ * chains. Installing a new puddle in a shard and popping a previous puddle still lock the whole pool.
  */
 class MM_SublistPool
 {
@@ -64,7 +71,9 @@ private:
 	volatile uintptr_t _count; /**< A count for number of elements across all sublistPuddles */
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
-	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	MM_SublistPuddle *_previousLists[OMR_SUBLIST_POOL_MAX_SHARDS]; /**< The non-empty puddles when #startProcessingSublist() was called, chained by the shard that filled them */
+	uintptr_t _shardCount; /**< The number of shards fragments are allocated from */
+	MM_SublistPuddle *_shardAllocPuddles[OMR_SUBLIST_POOL_MAX_SHARDS]; /**< The puddle each shard allocates fragments from (unused with a single shard, which allocates from _allocPuddle) */
 	
 protected:
 public:
@@ -75,6 +84,9 @@ public:
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
+	uintptr_t getShard(MM_EnvironmentBase *env);
+	bool allocateFromShard(MM_EnvironmentBase *env, MM_SublistFragment *fragment, uintptr_t shard);
+	void resetShardAllocPuddles() { memset(_shardAllocPuddles, 0, sizeof(_shardAllocPuddles)); }
 
 protected:
 public:
@@ -85,6 +97,13 @@ public:
 	MMINLINE uintptr_t getGrowSize() { return _growSize; }
 	MMINLINE void setMaxSize(uintptr_t maxSize) { _maxSize = maxSize; }
 	MMINLINE uintptr_t getMaxSize() { return _maxSize; }
+
+	/**
+	 * Split the pool into shardCount shards. Must be called before any fragment is allocated.
+	 * @param shardCount number of shards, from 1 up to OMR_SUBLIST_POOL_MAX_SHARDS
+	 */
+	MMINLINE void setShardCount(uintptr_t shardCount) { _shardCount = shardCount; }
+	MMINLINE uintptr_t getShardCount() { return _shardCount; }
 	
 	MMINLINE void incrementCount(uintptr_t count)
 	{
@@ -102,6 +121,12 @@ public:
 	
 	uintptr_t countElements();
 
+	/**
+	 * Count the elements held in the puddles of each shard. Fragments must be flushed for the count to be exact.
+	 * @param shardCounts[out] array of #getShardCount() entries receiving the count of each shard
+	 */
+	void countShardElements(uintptr_t *shardCounts);
+
 	MMINLINE bool isEmpty() { return _currentSize == 0 ? true : false; };
 
 	bool allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment);
@@ -112,19 +137,20 @@ public:
 	
 	/**
 	 * Prepare to process this sublist by moving all of its non-empty puddles onto
-	 * the list of previous puddles. The puddles may be retrieved by calling #popPreviousPuddle().
+	 * the lists of previous puddles of their shards. The puddles may be retrieved by calling #popPreviousPuddle().
 	 */
 	void startProcessingSublist();
 
 	/**
-	 * Pop a puddle from the list of puddles which were active when #startProcessingSublist() was called.
+	 * Pop a puddle from the list of puddles which were active when #startProcessingSublist() was called,
+	 * taking the puddles of the calling thread's shard before those of the other shards.
 	 * Return returnedPuddle to the list of puddles. It should be a puddle returned by a previous call to this function. 
 	 * This is protected by a lock, so may safely be called by multiple threads.
 	 * 
 	 * @param emptyPuddle[in] a puddle which has already been processed, or NULL
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
-	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+	MM_SublistPuddle *popPreviousPuddle(MM_EnvironmentBase *env, MM_SublistPuddle * returnedPuddle);
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -135,8 +161,11 @@ public:
 		, _maxSize(0)
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
-		, _previousList(NULL)
-	{}
+		, _shardCount(1)
+	{
+		memset(_previousLists, 0, sizeof(_previousLists));
+		resetShardAllocPuddles();
+	}
 
 	friend class GC_SublistIterator;
 };
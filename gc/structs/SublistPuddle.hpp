@@ -61,6 +61,7 @@ private:
 	uintptr_t *_listTop;
 
 	uintptr_t _size;
+	uintptr_t _shard; /**< Shard of the parent pool whose fragments are allocated from this puddle */
 
 protected:
 public:
@@ -94,6 +95,9 @@ public:
 	MMINLINE MM_SublistPuddle *getNext() { return _next; }
 	MMINLINE void setNext(MM_SublistPuddle *next) { _next = next; }
 
+	MMINLINE uintptr_t getShard() { return _shard; }
+	MMINLINE void setShard(uintptr_t shard) { _shard = shard; }
+
 	MM_SublistPuddle() {}
 
 	friend class GC_SublistIterator;
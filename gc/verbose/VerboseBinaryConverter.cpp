@@ -0,0 +1,474 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryConverter.hpp"
+
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+/* Size of the staging buffer for the XML output */
+#define VERBOSE_CONVERTER_OUTPUT_SIZE (64 * 1024)
+/* Longest conversion specification, after '*' values have been substituted */
+#define VERBOSE_CONVERTER_SPEC_SIZE 64
+
+/**
+ * Staging buffer for the XML output.
+ */
+typedef struct VerboseConverterOutput {
+	OMRPortLibrary *portLibrary;
+	intptr_t fd; /**< file being written */
+	char *buffer; /**< pending output */
+	uintptr_t size; /**< allocated size of buffer */
+	uintptr_t used; /**< bytes of buffer in use */
+} VerboseConverterOutput;
+
+static void
+flushOutput(VerboseConverterOutput *output)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(output->portLibrary);
+	if (0 != output->used) {
+		omrfile_write_text(output->fd, output->buffer, output->used);
+		output->used = 0;
+	}
+}
+
+/**
+ * The buffer is only written out between records (see flushOutput()) so that a line that cannot be decoded
+ * can be taken back.
+ * @return room for size more bytes of output, or NULL on allocation failure
+ */
+static char *
+reserveOutput(VerboseConverterOutput *output, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(output->portLibrary);
+	if ((output->used + size) > output->size) {
+		uintptr_t newSize = output->size * 2;
+		while (newSize < (output->used + size)) {
+			newSize *= 2;
+		}
+		char *buffer = (char *)omrmem_allocate_memory(newSize, OMRMEM_CATEGORY_MM);
+		if (NULL == buffer) {
+			return NULL;
+		}
+		memcpy(buffer, output->buffer, output->used);
+		omrmem_free_memory(output->buffer);
+		output->buffer = buffer;
+		output->size = newSize;
+	}
+	return output->buffer + output->used;
+}
+
+static bool
+appendOutput(VerboseConverterOutput *output, const char *text, uintptr_t length)
+{
+	char *cursor = reserveOutput(output, length);
+	if (NULL == cursor) {
+		return false;
+	}
+	memcpy(cursor, text, length);
+	output->used += length;
+	return true;
+}
+
+/**
+ * Read a whole file into memory.
+ * @return the contents, to be freed by the caller, or NULL on failure
+ */
+static uint8_t *
+readFile(OMRPortLibrary *portLibrary, const char *fileName, uintptr_t *length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return NULL;
+	}
+
+	uint8_t *contents = NULL;
+	int64_t fileLength = omrfile_flength(fd);
+	if (fileLength >= 0) {
+		contents = (uint8_t *)omrmem_allocate_memory((uintptr_t)fileLength + 1, OMRMEM_CATEGORY_MM);
+	}
+	if (NULL != contents) {
+		uintptr_t offset = 0;
+		while (offset < (uintptr_t)fileLength) {
+			intptr_t bytesRead = omrfile_read(fd, contents + offset, (intptr_t)((uintptr_t)fileLength - offset));
+			if (bytesRead <= 0) {
+				break;
+			}
+			offset += (uintptr_t)bytesRead;
+		}
+		*length = offset;
+	}
+	omrfile_close(fd);
+
+	return contents;
+}
+
+/**
+ * Format one conversion of a line, reading its values from the stream.
+ * @return the position following the values, or NULL if the stream is truncated or the output fails
+ */
+static const uint8_t *
+outputConversion(VerboseConverterOutput *output, MM_VerboseBinaryStringCache *strings, VerboseBinaryConversion *conversion, const uint8_t *cursor, const uint8_t *top, char **scratch, uintptr_t *scratchSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(output->portLibrary);
+
+	if (VERBOSE_BINARY_ARG_NONE == conversion->type) {
+		return appendOutput(output, "%", 1) ? cursor : NULL;
+	}
+
+	/* Rebuild the specification with the '*' values written in */
+	char spec[VERBOSE_CONVERTER_SPEC_SIZE];
+	uintptr_t specLength = 0;
+	for (const char *c = conversion->start; c < conversion->end; c++) {
+		if ((specLength + 12) >= sizeof(spec)) {
+			return NULL;
+		}
+		if ('*' == *c) {
+			uint64_t star = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &star);
+			if (NULL == cursor) {
+				return NULL;
+			}
+			specLength += omrstr_printf(spec + specLength, sizeof(spec) - specLength, "%u", (uint32_t)star);
+		} else {
+			spec[specLength++] = *c;
+		}
+	}
+	spec[specLength] = '\0';
+
+	uint64_t value = 0;
+	double doubleValue = 0.0;
+	const char *string = NULL;
+	switch (conversion->type) {
+	case VERBOSE_BINARY_ARG_U32:
+	case VERBOSE_BINARY_ARG_U64:
+	case VERBOSE_BINARY_ARG_POINTER:
+		cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &value);
+		break;
+	case VERBOSE_BINARY_ARG_STRING:
+		cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &value);
+		if ((NULL != cursor) && (0 != value)) {
+			uint64_t length = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &length);
+			/* every run takes at least two bytes and copies at most a cached string */
+			if ((NULL == cursor) || (length > ((uint64_t)(top - cursor) * VERBOSE_BINARY_STRING_CACHE_LENGTH))) {
+				return NULL;
+			}
+			if (*scratchSize <= length) {
+				omrmem_free_memory(*scratch);
+				*scratchSize = (uintptr_t)length + 1;
+				*scratch = (char *)omrmem_allocate_memory(*scratchSize, OMRMEM_CATEGORY_MM);
+				if (NULL == *scratch) {
+					*scratchSize = 0;
+					return NULL;
+				}
+			}
+			cursor = strings->read(cursor, top, (uintptr_t)value - 1, (uintptr_t)length, *scratch);
+			string = *scratch;
+		}
+		break;
+	case VERBOSE_BINARY_ARG_DOUBLE:
+		if ((uintptr_t)(top - cursor) < sizeof(uint64_t)) {
+			return NULL;
+		}
+		for (uintptr_t i = 0; i < sizeof(uint64_t); i++) {
+			value |= ((uint64_t)*cursor++) << (i * 8);
+		}
+		memcpy(&doubleValue, &value, sizeof(doubleValue));
+		break;
+	default:
+		return NULL;
+	}
+	if (NULL == cursor) {
+		return NULL;
+	}
+
+	/* Each value is handed to omrstr_printf() with the type omrstr_vprintf() read it as when the line was written */
+	uintptr_t length = 0;
+	switch (conversion->type) {
+	case VERBOSE_BINARY_ARG_U32:
+		length = omrstr_printf(NULL, 0, spec, (uint32_t)value);
+		break;
+	case VERBOSE_BINARY_ARG_U64:
+		length = omrstr_printf(NULL, 0, spec, value);
+		break;
+	case VERBOSE_BINARY_ARG_POINTER:
+		length = omrstr_printf(NULL, 0, spec, (void *)(uintptr_t)value);
+		break;
+	case VERBOSE_BINARY_ARG_STRING:
+		length = omrstr_printf(NULL, 0, spec, string);
+		break;
+	case VERBOSE_BINARY_ARG_DOUBLE:
+		length = omrstr_printf(NULL, 0, spec, doubleValue);
+		break;
+	default:
+		break;
+	}
+
+	char *buffer = reserveOutput(output, length + 1);
+	if (NULL == buffer) {
+		return NULL;
+	}
+	switch (conversion->type) {
+	case VERBOSE_BINARY_ARG_U32:
+		output->used += omrstr_printf(buffer, length + 1, spec, (uint32_t)value);
+		break;
+	case VERBOSE_BINARY_ARG_U64:
+		output->used += omrstr_printf(buffer, length + 1, spec, value);
+		break;
+	case VERBOSE_BINARY_ARG_POINTER:
+		output->used += omrstr_printf(buffer, length + 1, spec, (void *)(uintptr_t)value);
+		break;
+	case VERBOSE_BINARY_ARG_STRING:
+		output->used += omrstr_printf(buffer, length + 1, spec, string);
+		break;
+	case VERBOSE_BINARY_ARG_DOUBLE:
+		output->used += omrstr_printf(buffer, length + 1, spec, doubleValue);
+		break;
+	default:
+		break;
+	}
+
+	return cursor;
+}
+
+/**
+ * Reproduce one line from its format and the values recorded in the stream.
+ * @return the position following the line, or NULL if the stream is truncated or the output fails
+ */
+static const uint8_t *
+outputLine(VerboseConverterOutput *output, MM_VerboseBinaryStringCache *strings, const char *format, uintptr_t indent, const uint8_t *cursor, const uint8_t *top, char **scratch, uintptr_t *scratchSize)
+{
+	for (uintptr_t i = 0; i < indent; i++) {
+		if (!appendOutput(output, VERBOSEGC_INDENT_SPACER, strlen(VERBOSEGC_INDENT_SPACER))) {
+			return NULL;
+		}
+	}
+
+	VerboseBinaryConversion conversion;
+	const char *literal = format;
+	while (MM_VerboseBinaryFormat::nextConversion(literal, &conversion)) {
+		if (!appendOutput(output, literal, conversion.start - literal)) {
+			return NULL;
+		}
+		cursor = outputConversion(output, strings, &conversion, cursor, top, scratch, scratchSize);
+		if (NULL == cursor) {
+			return NULL;
+		}
+		literal = conversion.end;
+	}
+	if (!appendOutput(output, literal, strlen(literal)) || !appendOutput(output, "\n", 1)) {
+		return NULL;
+	}
+
+	return cursor;
+}
+
+bool
+MM_VerboseBinaryConverter::isBinaryLog(OMRPortLibrary *portLibrary, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 != fd) {
+		char magic[VERBOSE_BINARY_MAGIC_LENGTH];
+		if (VERBOSE_BINARY_MAGIC_LENGTH == omrfile_read(fd, magic, VERBOSE_BINARY_MAGIC_LENGTH)) {
+			result = (0 == memcmp(magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH));
+		}
+		omrfile_close(fd);
+	}
+
+	return result;
+}
+
+bool
+MM_VerboseBinaryConverter::convert(OMRPortLibrary *portLibrary, const char *inputFileName, const char *outputFileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+	uintptr_t inputLength = 0;
+	const char **formats = NULL;
+	uintptr_t formatCount = 0;
+	char *scratch = NULL;
+	uintptr_t scratchSize = 0;
+	char *version = NULL;
+	uint64_t value = 0;
+	MM_VerboseBinaryStringCache strings;
+	VerboseConverterOutput output;
+	output.portLibrary = portLibrary;
+	output.fd = -1;
+	output.buffer = NULL;
+	output.size = VERBOSE_CONVERTER_OUTPUT_SIZE;
+	output.used = 0;
+
+	uint8_t *input = readFile(portLibrary, inputFileName, &inputLength);
+	if (NULL == input) {
+		return false;
+	}
+	const uint8_t *cursor = input;
+	const uint8_t *top = input + inputLength;
+
+	/* Stream header */
+	if ((inputLength < (VERBOSE_BINARY_MAGIC_LENGTH + 2)) || (0 != memcmp(cursor, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH))) {
+		goto done;
+	}
+	cursor += VERBOSE_BINARY_MAGIC_LENGTH;
+	if (VERBOSE_BINARY_VERSION != *cursor++) {
+		goto done;
+	}
+	/* %zu and %p values were read with the size of the writer's pointers */
+	if (sizeof(uintptr_t) != *cursor++) {
+		goto done;
+	}
+	cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &value);
+	if ((NULL == cursor) || ((uint64_t)(top - cursor) < value)) {
+		goto done;
+	}
+	version = (char *)omrmem_allocate_memory((uintptr_t)value + 1, OMRMEM_CATEGORY_MM);
+	if (NULL == version) {
+		goto done;
+	}
+	memcpy(version, cursor, (uintptr_t)value);
+	version[value] = '\0';
+	cursor += value;
+
+	output.buffer = (char *)omrmem_allocate_memory(output.size, OMRMEM_CATEGORY_MM);
+	if (NULL == output.buffer) {
+		goto done;
+	}
+	output.fd = omrfile_open(outputFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == output.fd) {
+		goto done;
+	}
+
+	{
+		uintptr_t headerLength = omrstr_printf(NULL, 0, VERBOSEGC_HEADER, version);
+		char *header = reserveOutput(&output, headerLength + 1);
+		if (NULL == header) {
+			goto done;
+		}
+		output.used += omrstr_printf(header, headerLength + 1, VERBOSEGC_HEADER, version);
+	}
+
+	/* Records */
+	while (cursor < top) {
+		if (output.used >= VERBOSE_CONVERTER_OUTPUT_SIZE) {
+			flushOutput(&output);
+		}
+		uint8_t tag = *cursor++;
+		if (VERBOSE_BINARY_RECORD_END == tag) {
+			result = (cursor == top);
+			break;
+		} else if (VERBOSE_BINARY_RECORD_DEFINE == tag) {
+			uint64_t id = 0;
+			uint64_t length = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &id);
+			if (NULL != cursor) {
+				cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &length);
+			}
+			if ((NULL == cursor) || ((uint64_t)(top - cursor) < length)) {
+				break;
+			}
+			if (id >= formatCount) {
+				uintptr_t newCount = (0 == formatCount) ? 256 : formatCount;
+				while (newCount <= id) {
+					newCount *= 2;
+				}
+				const char **newFormats = (const char **)omrmem_allocate_memory(newCount * sizeof(char *), OMRMEM_CATEGORY_MM);
+				if (NULL == newFormats) {
+					break;
+				}
+				memset(newFormats, 0, newCount * sizeof(char *));
+				if (NULL != formats) {
+					memcpy(newFormats, formats, formatCount * sizeof(char *));
+					omrmem_free_memory((void *)formats);
+				}
+				formats = newFormats;
+				formatCount = newCount;
+			}
+			char *format = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+			if (NULL == format) {
+				break;
+			}
+			memcpy(format, cursor, (uintptr_t)length);
+			format[length] = '\0';
+			omrmem_free_memory((void *)formats[id]);
+			formats[id] = format;
+			cursor += length;
+		} else if (VERBOSE_BINARY_RECORD_LINE == tag) {
+			uint64_t id = 0;
+			uint64_t indent = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &id);
+			if (NULL != cursor) {
+				cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &indent);
+			}
+			if ((NULL == cursor) || (id >= formatCount) || (NULL == formats[id])) {
+				break;
+			}
+			uintptr_t lineStart = output.used;
+			cursor = outputLine(&output, &strings, formats[id], (uintptr_t)indent, cursor, top, &scratch, &scratchSize);
+			if (NULL == cursor) {
+				/* Drop the partial line */
+				output.used = lineStart;
+				break;
+			}
+		} else if (VERBOSE_BINARY_RECORD_TEXT == tag) {
+			uint64_t length = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &length);
+			if ((NULL == cursor) || ((uint64_t)(top - cursor) < length)) {
+				break;
+			}
+			if (!appendOutput(&output, (const char *)cursor, (uintptr_t)length)) {
+				break;
+			}
+			cursor += length;
+		} else {
+			/* Unknown record */
+			break;
+		}
+	}
+
+	/* Close the document even if the stream stopped short */
+	appendOutput(&output, VERBOSEGC_FOOTER, strlen(VERBOSEGC_FOOTER));
+	appendOutput(&output, "\n", 1);
+	flushOutput(&output);
+
+done:
+	if (-1 != output.fd) {
+		omrfile_close(output.fd);
+	}
+	if (NULL != formats) {
+		for (uintptr_t i = 0; i < formatCount; i++) {
+			omrmem_free_memory((void *)formats[i]);
+		}
+		omrmem_free_memory((void *)formats);
+	}
+	omrmem_free_memory(output.buffer);
+	omrmem_free_memory(scratch);
+	omrmem_free_memory(version);
+	omrmem_free_memory(input);
+
+	return result;
+}
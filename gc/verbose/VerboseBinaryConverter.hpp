@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYCONVERTER_HPP_)
+#define VERBOSEBINARYCONVERTER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+/**
+ * Turns binary verbose GC files (-Xgc:binaryLogging, see VerboseBinaryFormat.hpp) back into the XML the
+ * other verbose writers produce.  Only depends on the port library so that tools can use it without a VM.
+ */
+class MM_VerboseBinaryConverter
+{
+public:
+	/**
+	 * @return true if the file starts with the binary verbose GC stream header, false otherwise
+	 */
+	static bool isBinaryLog(OMRPortLibrary *portLibrary, const char *fileName);
+
+	/**
+	 * Convert a binary verbose GC file to XML.  A file which was not closed cleanly is converted up to the
+	 * last complete record and still gets a closing tag.
+	 * @param portLibrary the port library
+	 * @param inputFileName the binary file
+	 * @param outputFileName the XML file to create
+	 * @return true if the whole file was converted, false otherwise
+	 */
+	static bool convert(OMRPortLibrary *portLibrary, const char *inputFileName, const char *outputFileName);
+};
+
+#endif /* VERBOSEBINARYCONVERTER_HPP_ */
@@ -0,0 +1,438 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+
+#include <string.h>
+
+/**
+ * @file
+ * Layout of the binary verbose GC stream (-Xgc:binaryLogging).
+ *
+ * Rather than formatted XML, the stream records the format string of each line once per file and then
+ * only the raw arguments of every line that uses it, so that the verbose output can be reproduced byte
+ * for byte by running the same format strings through omrstr_printf() offline (see MM_VerboseBinaryConverter).
+ *
+ * Stream layout, all integers are unsigned LEB128 varints unless stated otherwise:
+ *   header:  VERBOSE_BINARY_MAGIC (8 bytes), version (1 byte), pointer size (1 byte), GC version string length, GC version string
+ *   records: tag (1 byte) followed by
+ *     VERBOSE_BINARY_RECORD_DEFINE  format id, format length, format string (no terminator)
+ *     VERBOSE_BINARY_RECORD_LINE    format id, indent, one value per conversion in the format (see VerboseBinaryArgType)
+ *     VERBOSE_BINARY_RECORD_TEXT    length, text (no terminator)
+ *     VERBOSE_BINARY_RECORD_END     nothing, the writer closed the file cleanly
+ *
+ * Most %s arguments are timestamps, names and types that repeat from one event to the next, so strings are
+ * stored relative to a small cache of recently written strings (see MM_VerboseBinaryStringCache) that the
+ * writer and the converter update in step.
+ *
+ * Format ids and the string cache are only meaningful within the file that defines them.  Any change to the layout must bump
+ * VERBOSE_BINARY_VERSION.
+ */
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+#define VERBOSE_BINARY_VERSION 1
+
+/* Output constants, shared by the XML writers and the binary converter */
+#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define VERBOSEGC_FOOTER "</verbosegc>\n"
+#define VERBOSEGC_INDENT_SPACER "  "
+
+typedef enum {
+	VERBOSE_BINARY_RECORD_DEFINE = 1, /**< Format string used by later lines */
+	VERBOSE_BINARY_RECORD_LINE, /**< Arguments of one line of output */
+	VERBOSE_BINARY_RECORD_TEXT, /**< Preformatted output */
+	VERBOSE_BINARY_RECORD_END /**< Clean end of the file */
+} VerboseBinaryRecordType;
+
+/**
+ * How the argument of a conversion is read by omrstr_vprintf() and stored in the stream.
+ */
+typedef enum {
+	VERBOSE_BINARY_ARG_NONE = 0, /**< No argument, e.g. %% */
+	VERBOSE_BINARY_ARG_U32, /**< 32 bit integer, stored as a varint */
+	VERBOSE_BINARY_ARG_U64, /**< 64 bit integer, stored as a varint */
+	VERBOSE_BINARY_ARG_POINTER, /**< %p, stored as a varint */
+	VERBOSE_BINARY_ARG_STRING, /**< %s, stored as a varint of cache slot + 1 (0 for NULL) and, unless NULL, the length and runs described by MM_VerboseBinaryStringCache */
+	VERBOSE_BINARY_ARG_DOUBLE, /**< floating point, stored as the 8 byte IEEE image, least significant byte first */
+	VERBOSE_BINARY_ARG_UNSUPPORTED /**< Conversion the stream cannot represent; the line is recorded as text */
+} VerboseBinaryArgType;
+
+/**
+ * One conversion specification within a format string.
+ */
+typedef struct VerboseBinaryConversion {
+	const char *start; /**< the '%' introducing the conversion */
+	const char *end; /**< one past the conversion character */
+	uintptr_t starCount; /**< number of '*' width or precision values (32 bit integers) consumed ahead of the argument */
+	VerboseBinaryArgType type; /**< type of the argument */
+} VerboseBinaryConversion;
+
+/**
+ * Encoding helpers shared by the binary writer and the converter.
+ */
+class MM_VerboseBinaryFormat
+{
+public:
+	/**
+	 * Find the next conversion in a format string.  The grammar and argument types mirror omrstr_vprintf().
+	 * @param[in] format the remainder of the format string
+	 * @param[out] conversion the conversion found
+	 * @return true if a conversion was found, false at the end of the format
+	 */
+	static bool
+	nextConversion(const char *format, VerboseBinaryConversion *conversion)
+	{
+		while (('\0' != *format) && ('%' != *format)) {
+			format += 1;
+		}
+		if ('\0' == *format) {
+			return false;
+		}
+
+		conversion->start = format;
+		conversion->starCount = 0;
+		conversion->type = VERBOSE_BINARY_ARG_UNSUPPORTED;
+		format += 1;
+
+		if ('%' == *format) {
+			conversion->end = format + 1;
+			conversion->type = VERBOSE_BINARY_ARG_NONE;
+			return true;
+		}
+
+		/* flags */
+		while (('-' == *format) || ('+' == *format) || (' ' == *format) || ('#' == *format) || ('0' == *format)) {
+			format += 1;
+		}
+		/* width */
+		if ('*' == *format) {
+			conversion->starCount += 1;
+			format += 1;
+		} else {
+			while (('0' <= *format) && ('9' >= *format)) {
+				format += 1;
+			}
+		}
+		if ('$' == *format) {
+			/* positional arguments are not supported */
+			conversion->end = format + 1;
+			return true;
+		}
+		/* precision */
+		if ('.' == *format) {
+			format += 1;
+			if ('*' == *format) {
+				conversion->starCount += 1;
+				format += 1;
+			} else {
+				while (('0' <= *format) && ('9' >= *format)) {
+					format += 1;
+				}
+			}
+		}
+		/* modifier */
+		bool wide = false;
+		if ('z' == *format) {
+			format += 1;
+#if defined(OMR_ENV_DATA64)
+			wide = true;
+#endif /* OMR_ENV_DATA64 */
+		} else if ('l' == *format) {
+			format += 1;
+			if ('l' == *format) {
+				format += 1;
+				wide = true;
+			}
+		}
+
+		switch (*format) {
+		case 'c':
+			conversion->type = VERBOSE_BINARY_ARG_U32;
+			break;
+		case 'i':
+		case 'd':
+		case 'u':
+		case 'x':
+		case 'X':
+			conversion->type = wide ? VERBOSE_BINARY_ARG_U64 : VERBOSE_BINARY_ARG_U32;
+			break;
+		case 'p':
+			conversion->type = VERBOSE_BINARY_ARG_POINTER;
+			break;
+		case 's':
+			conversion->type = VERBOSE_BINARY_ARG_STRING;
+			break;
+		case 'f':
+		case 'e':
+		case 'E':
+		case 'F':
+		case 'g':
+		case 'G':
+			conversion->type = VERBOSE_BINARY_ARG_DOUBLE;
+			break;
+		default:
+			break;
+		}
+		if ('\0' != *format) {
+			format += 1;
+		}
+		conversion->end = format;
+
+		return true;
+	}
+
+	/**
+	 * @return the largest number of bytes writeUnsigned() may write
+	 */
+	static MMINLINE uintptr_t maxUnsignedSize() { return 10; }
+
+	/**
+	 * Encode a varint.
+	 * @return the position following the encoded value
+	 */
+	static MMINLINE uint8_t *
+	writeUnsigned(uint8_t *cursor, uint64_t value)
+	{
+		while (value >= 0x80) {
+			*cursor++ = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		*cursor++ = (uint8_t)value;
+		return cursor;
+	}
+
+	/**
+	 * Decode a varint.
+	 * @return the position following the encoded value, or NULL if the value runs past top
+	 */
+	static MMINLINE const uint8_t *
+	readUnsigned(const uint8_t *cursor, const uint8_t *top, uint64_t *value)
+	{
+		uint64_t result = 0;
+		uintptr_t shift = 0;
+		while (cursor < top) {
+			uint8_t byte = *cursor++;
+			result |= ((uint64_t)(byte & 0x7F)) << shift;
+			if (0 == (byte & 0x80)) {
+				*value = result;
+				return cursor;
+			}
+			shift += 7;
+			if (shift >= 64) {
+				break;
+			}
+		}
+		return NULL;
+	}
+};
+
+#define VERBOSE_BINARY_STRING_CACHE_SLOTS 16
+#define VERBOSE_BINARY_STRING_CACHE_LENGTH 128
+/* Matches shorter than this are cheaper to store as literal characters */
+#define VERBOSE_BINARY_STRING_MIN_COPY 3
+
+/**
+ * Recently written %s arguments.  Most strings differ from an earlier one only in a few places (ids,
+ * timestamps, sizes), so a string is stored as its length and the cache slot it is closest to, followed by
+ * runs of (number of characters copied from the same position in the slot, number of literal characters,
+ * literal characters) until the whole string is covered.  When at least half the string was copied it
+ * replaces the slot it was stored against, otherwise it replaces the slots round robin.  Only the first
+ * VERBOSE_BINARY_STRING_CACHE_LENGTH characters of a string are cached.
+ */
+class MM_VerboseBinaryStringCache
+{
+private:
+	char _strings[VERBOSE_BINARY_STRING_CACHE_SLOTS][VERBOSE_BINARY_STRING_CACHE_LENGTH]; /**< cached strings, not NUL terminated */
+	uintptr_t _lengths[VERBOSE_BINARY_STRING_CACHE_SLOTS]; /**< number of characters cached in each slot */
+	uintptr_t _nextVictim; /**< slot replaced by the next string that has little in common with the cache */
+
+	/**
+	 * @return the number of characters from position on that can be copied from a slot
+	 */
+	MMINLINE uintptr_t
+	matchLength(uintptr_t slot, const char *string, uintptr_t length, uintptr_t position)
+	{
+		uintptr_t limit = OMR_MIN(length, _lengths[slot]);
+		uintptr_t match = position;
+		while ((match < limit) && (_strings[slot][match] == string[match])) {
+			match += 1;
+		}
+		return match - position;
+	}
+
+	/**
+	 * Split the string at position into the next run.
+	 * @param[out] copy the number of characters copied from the slot
+	 * @param[out] literal the number of literal characters that follow
+	 */
+	MMINLINE void
+	nextRun(uintptr_t slot, const char *string, uintptr_t length, uintptr_t position, uintptr_t *copy, uintptr_t *literal)
+	{
+		*copy = matchLength(slot, string, length, position);
+		uintptr_t end = position + *copy;
+		while (end < length) {
+			uintptr_t match = matchLength(slot, string, length, end);
+			if ((match >= VERBOSE_BINARY_STRING_MIN_COPY) || ((end + match) == length)) {
+				break;
+			}
+			end += OMR_MAX(match, (uintptr_t)1);
+		}
+		*literal = end - position - *copy;
+	}
+
+	/**
+	 * Cache a string once it has been written or read.
+	 */
+	void
+	update(uintptr_t slot, uintptr_t copied, const char *string, uintptr_t length)
+	{
+		if ((copied * 2) < length) {
+			slot = _nextVictim;
+			_nextVictim = (_nextVictim + 1) % VERBOSE_BINARY_STRING_CACHE_SLOTS;
+		}
+		uintptr_t cached = OMR_MIN(length, (uintptr_t)VERBOSE_BINARY_STRING_CACHE_LENGTH);
+		memcpy(_strings[slot], string, cached);
+		_lengths[slot] = cached;
+	}
+
+public:
+	void
+	reset()
+	{
+		for (uintptr_t slot = 0; slot < VERBOSE_BINARY_STRING_CACHE_SLOTS; slot++) {
+			_lengths[slot] = 0;
+		}
+		_nextVictim = 0;
+	}
+
+	/**
+	 * @return the largest number of bytes write() may use for a string of the given length
+	 */
+	static MMINLINE uintptr_t
+	maxEncodedSize(uintptr_t length)
+	{
+		return ((2 + (2 * length)) * MM_VerboseBinaryFormat::maxUnsignedSize()) + length;
+	}
+
+	/**
+	 * Encode a non-NULL string against the slot that stores it most compactly, and cache it.
+	 * @return the position following the encoded string
+	 */
+	uint8_t *
+	write(uint8_t *cursor, const char *string)
+	{
+		uintptr_t length = strlen(string);
+
+		/* Pick the slot leaving the fewest literal characters and runs */
+		uintptr_t best = 0;
+		uintptr_t bestCost = UDATA_MAX;
+		for (uintptr_t slot = 0; (slot < VERBOSE_BINARY_STRING_CACHE_SLOTS) && (0 != bestCost); slot++) {
+			uintptr_t cost = 0;
+			uintptr_t position = 0;
+			while (position < length) {
+				uintptr_t copy = 0;
+				uintptr_t literal = 0;
+				nextRun(slot, string, length, position, &copy, &literal);
+				cost += 2 + literal;
+				position += copy + literal;
+			}
+			if (cost < bestCost) {
+				best = slot;
+				bestCost = cost;
+			}
+		}
+
+		cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, best + 1);
+		cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, length);
+		uintptr_t copied = 0;
+		uintptr_t position = 0;
+		while (position < length) {
+			uintptr_t copy = 0;
+			uintptr_t literal = 0;
+			nextRun(best, string, length, position, &copy, &literal);
+			cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, copy);
+			cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, literal);
+			memcpy(cursor, string + position + copy, literal);
+			cursor += literal;
+			copied += copy;
+			position += copy + literal;
+		}
+		update(best, copied, string, length);
+
+		return cursor;
+	}
+
+	/**
+	 * Decode a non-NULL string written by write(), and cache it.
+	 * @param slot the slot read ahead of the string
+	 * @param length the length read ahead of the string
+	 * @param[out] string room for length characters and a terminator
+	 * @return the position following the encoded string, or NULL if the string is damaged or runs past top
+	 */
+	const uint8_t *
+	read(const uint8_t *cursor, const uint8_t *top, uintptr_t slot, uintptr_t length, char *string)
+	{
+		if (slot >= VERBOSE_BINARY_STRING_CACHE_SLOTS) {
+			return NULL;
+		}
+		uintptr_t copied = 0;
+		uintptr_t position = 0;
+		while (position < length) {
+			uint64_t copy = 0;
+			uint64_t literal = 0;
+			cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &copy);
+			if (NULL != cursor) {
+				cursor = MM_VerboseBinaryFormat::readUnsigned(cursor, top, &literal);
+			}
+			if ((NULL == cursor)
+				|| ((0 == copy) && (0 == literal))
+				|| (copy > (_lengths[slot] - OMR_MIN(position, _lengths[slot])))
+				|| ((copy + literal) > (length - position))
+				|| ((uint64_t)(top - cursor) < literal)
+			) {
+				return NULL;
+			}
+			memcpy(string + position, _strings[slot] + position, (uintptr_t)copy);
+			memcpy(string + position + copy, cursor, (uintptr_t)literal);
+			cursor += literal;
+			copied += (uintptr_t)copy;
+			position += (uintptr_t)(copy + literal);
+		}
+		string[length] = '\0';
+		update(slot, copied, string, length);
+
+		return cursor;
+	}
+
+	MM_VerboseBinaryStringCache()
+	{
+		reset();
+	}
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -27,6 +27,11 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "CollectionStatistics.hpp"
+#include "Heap.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "VerboseHandlerOutput.hpp"
@@ -743,6 +748,39 @@ MM_VerboseHandlerOutput::outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, ui
 {
 }
 
+void
+MM_VerboseHandlerOutput::outputFreeListSearchStats(MM_EnvironmentBase* env)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_MemorySpace *defaultMemorySpace = _extensions->heap->getDefaultMemorySpace();
+	MM_MemorySubSpace *tenureMemorySubSpace = (NULL != defaultMemorySpace) ? defaultMemorySpace->getTenureMemorySubSpace() : NULL;
+	MM_MemoryPool *tenureMemoryPool = (NULL != tenureMemorySubSpace) ? tenureMemorySubSpace->getMemoryPool() : NULL;
+
+	if (NULL != tenureMemoryPool) {
+		uintptr_t searchCount = 0;
+		uintptr_t searchLength = 0;
+		uintptr_t searchLengthMax = 0;
+
+		/* Searches are recorded by the leaf pools (e.g. both SOA and LOA), so sum over the children of a parent pool
+		 * rather than read its merged stats, which are only current right after a merge.
+		 */
+		bool hasChildren = (NULL != tenureMemoryPool->getChildren());
+		MM_MemoryPool *memoryPool = hasChildren ? tenureMemoryPool->getChildren() : tenureMemoryPool;
+		while (NULL != memoryPool) {
+			MM_LargeObjectAllocateStats *stats = memoryPool->getLargeObjectAllocateStats();
+			if (NULL != stats) {
+				searchCount += stats->getFreeListSearchCount();
+				searchLength += stats->getFreeListSearchLength();
+				searchLengthMax = OMR_MAX(searchLengthMax, stats->getFreeListSearchLengthMax());
+			}
+			memoryPool = hasChildren ? memoryPool->getNext() : NULL;
+		}
+
+		writer->formatAndOutput(env, 1, "<free-list-search count=\"%zu\" entries=\"%zu\" maxentries=\"%zu\" />",
+				searchCount, searchLength, searchLengthMax);
+	}
+}
+
 void
 MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 {
@@ -763,6 +801,13 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (_extensions->adaptiveTLH) {
+			writer->formatAndOutput(env, 1, "<tlh-refreshes fresh=\"%zu\" reused=\"%zu\" wastedBytes=\"%zu\" />",
+					systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhWastedBytes);
+		}
+		if (_extensions->freeListSizeClassIndex) {
+			outputFreeListSearchStats(env);
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -171,6 +171,12 @@ protected:
 	 */
 	virtual void handleAllocationFailureStartInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth);
 
+	/**
+	 * Print out the free list searches of object allocates into tenure since the last collection, summed over its pools.
+	 * @param env[in] the current thread
+	 */
+	void outputFreeListSearchStats(MM_EnvironmentBase* env);
+
 	/* Print out allocations statistics
 	 * @param current Env
 	 */
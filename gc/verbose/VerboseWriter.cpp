@@ -24,6 +24,8 @@
 
 #include "VerboseWriter.hpp"
 
+#include "VerboseBinaryFormat.hpp"
+
 #include "GCExtensionsBase.hpp"
 
 #undef _UTE_MODULE_HEADER_
@@ -31,10 +33,6 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-/* Output constants */
-#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
-#define VERBOSEGC_FOOTER "</verbosegc>\n"
-
 MM_VerboseWriter::MM_VerboseWriter(WriterType type)
 	: MM_Base()
 	,_nextWriter(NULL)
@@ -68,6 +66,30 @@ MM_VerboseWriter::setNextWriter(MM_VerboseWriter* writer)
 	_nextWriter = writer;
 }
 
+void
+MM_VerboseWriter::flushStream(MM_EnvironmentBase *env)
+{
+	/* No implementation */
+}
+
+bool
+MM_VerboseWriter::recordsLines()
+{
+	return false;
+}
+
+void
+MM_VerboseWriter::outputLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	/* No implementation */
+}
+
+void
+MM_VerboseWriter::flushLines(MM_EnvironmentBase *env)
+{
+	/* No implementation */
+}
+
 void
 MM_VerboseWriter::tearDown(MM_EnvironmentBase* env)
 {
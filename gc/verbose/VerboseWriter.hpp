@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,9 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 7
 } WriterType;
 
 /**
@@ -75,6 +78,31 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until all output handed to the writer so far has reached its destination.
+	 * Writers which output synchronously have nothing to do.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the writer records the format string and arguments of each line (see outputLine())
+	 * instead of receiving formatted text through outputString().
+	 */
+	virtual bool recordsLines();
+
+	/**
+	 * Record one line of output.  Only called on writers which answer true to recordsLines().
+	 * @param indent level of indentation of the line
+	 * @param format printf style format of the line, which must remain valid for the life of the writer
+	 * @param args arguments to the format
+	 */
+	virtual void outputLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Output the lines recorded since the last call.  Only called on writers which answer true to recordsLines().
+	 */
+	virtual void flushLines(MM_EnvironmentBase *env);
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
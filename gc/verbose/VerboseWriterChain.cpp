@@ -22,6 +22,7 @@
 
 #include "VerboseWriterChain.hpp"
 
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseBuffer.hpp"
 #include "VerboseWriter.hpp"
 
@@ -32,8 +33,6 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-#define INDENT_SPACER "  "
-
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
@@ -62,12 +61,29 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
-	for (uintptr_t i = 0; i < indent; ++i) {
-		_buffer->add(env, INDENT_SPACER);
+	bool formatText = false;
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->recordsLines()) {
+			va_list argsCopy;
+			COPY_VA_LIST(argsCopy, args);
+			writer->outputLine(env, indent, format, argsCopy);
+			END_VA_LIST_COPY(argsCopy);
+		} else {
+			formatText = true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	/* Skip the formatting entirely when every writer records lines */
+	if (formatText) {
+		for (uintptr_t i = 0; i < indent; ++i) {
+			_buffer->add(env, VERBOSEGC_INDENT_SPACER);
+		}
+
+		_buffer->vprintf(env, format, args);
+		_buffer->add(env, "\n");
 	}
-	
-	_buffer->vprintf(env, format, args);
-	_buffer->add(env, "\n");
 }
 
 void
@@ -85,7 +101,11 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->recordsLines()) {
+			writer->flushLines(env);
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
@@ -0,0 +1,511 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+/* Smallest ring the writer will run with, whatever the requested buffer size */
+#define VERBOSE_ASYNC_MINIMUM_RING_SIZE 4096
+
+/**
+ * Header preceding each record in the ring.  Records are padded to a multiple of the header size so that
+ * every header is aligned and the space left at the end of the ring is always large enough for a pad header.
+ */
+typedef struct VerboseAsyncRecordHeader {
+	uint32_t type; /**< VerboseAsyncRecordType of the record */
+	uint32_t length; /**< length of the payload following the header, excluding padding */
+} VerboseAsyncRecordHeader;
+
+extern "C" {
+
+/**
+ * Background writer thread procedure.
+ * @param info the owning writer
+ * @return always 0
+ */
+static int J9THREAD_PROC
+verbose_async_writer_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->writerEntryPoint();
+
+	return 0;
+}
+
+} /* extern "C" */
+
+/**
+ * @return the size of the ring record holding a payload of the given length
+ */
+static MMINLINE uintptr_t
+recordSize(uintptr_t length)
+{
+	uintptr_t size = sizeof(VerboseAsyncRecordHeader) + length;
+	return (size + sizeof(VerboseAsyncRecordHeader) - 1) & ~(uintptr_t)(sizeof(VerboseAsyncRecordHeader) - 1);
+}
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_ringHead(0)
+	,_ringTail(0)
+	,_pendingDrops(0)
+	,_droppedRecords(0)
+	,_droppedBytes(0)
+	,_writerThread(NULL)
+	,_writerMonitor(NULL)
+	,_writerWaiting(false)
+	,_writerBusy(false)
+	,_writerAlive(false)
+	,_writerShutdown(false)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * Opens the first log file, allocates the ring and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	/* A power of two ring lets the free running head and tail counters wrap safely */
+	_ringSize = VERBOSE_ASYNC_MINIMUM_RING_SIZE;
+	while (_ringSize < extensions->asyncLoggingBufferSize) {
+		_ringSize <<= 1;
+	}
+	_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_writerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::writerMonitor")) {
+		return false;
+	}
+
+	_writerAlive = true;
+	intptr_t forkResult = createThreadWithCategory(
+		&_writerThread,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		verbose_async_writer_thread_proc,
+		(void *)this,
+		J9THREAD_CATEGORY_SYSTEM_THREAD);
+	if (0 != forkResult) {
+		_writerAlive = false;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the writer thread once everything queued has been written, then closes the log file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _writerMonitor) {
+		stopWriterThread();
+		omrthread_monitor_destroy(_writerMonitor);
+		_writerMonitor = NULL;
+	}
+	closeFile(env);
+
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+/**
+ * Copy a record into the ring and publish it to the writer thread.
+ * @return true if the record was queued, false if the ring does not have room for it
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(VerboseAsyncRecordType type, const void *payload, uintptr_t length)
+{
+	uintptr_t size = recordSize(length);
+	uintptr_t head = _ringHead;
+	uintptr_t tail = _ringTail;
+	uintptr_t offset = head & (_ringSize - 1);
+	uintptr_t contiguous = _ringSize - offset;
+	/* Records never wrap; if this one does not fit before the end of the ring the remainder is padded out */
+	uintptr_t padding = (contiguous < size) ? contiguous : 0;
+
+	if ((padding + size) > (_ringSize - (head - tail))) {
+		return false;
+	}
+
+	if (0 != padding) {
+		VerboseAsyncRecordHeader *pad = (VerboseAsyncRecordHeader *)(_ring + offset);
+		pad->type = VERBOSE_ASYNC_RECORD_PAD;
+		pad->length = 0;
+		head += padding;
+		offset = 0;
+	}
+
+	VerboseAsyncRecordHeader *header = (VerboseAsyncRecordHeader *)(_ring + offset);
+	header->type = (uint32_t)type;
+	header->length = (uint32_t)length;
+	memcpy(header + 1, payload, length);
+
+	/* The record must be visible before the writer thread can see the new head */
+	MM_AtomicOperations::storeSync();
+	_ringHead = head + size;
+
+	return true;
+}
+
+/**
+ * Notify the writer thread if it is blocked waiting for records.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::wakeWriter()
+{
+	/* Order the head update against the read of _writerWaiting; the writer re-reads the head after setting it */
+	MM_AtomicOperations::sync();
+	if (_writerWaiting) {
+		omrthread_monitor_enter(_writerMonitor);
+		omrthread_monitor_notify_all(_writerMonitor);
+		omrthread_monitor_exit(_writerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+
+	/* Report any earlier loss in sequence, ahead of the output that follows it */
+	if ((0 == _pendingDrops) || enqueue(VERBOSE_ASYNC_RECORD_DROPPED, &_pendingDrops, sizeof(_pendingDrops))) {
+		_pendingDrops = 0;
+		if (enqueue(VERBOSE_ASYNC_RECORD_TEXT, string, length)) {
+			wakeWriter();
+			return;
+		}
+	}
+
+	_pendingDrops += 1;
+	_droppedRecords += 1;
+	_droppedBytes += length;
+}
+
+/**
+ * Queue a cycle boundary so that the writer thread rotates the output files in step with the output.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (enqueue(VERBOSE_ASYNC_RECORD_END_OF_CYCLE, NULL, 0)) {
+		wakeWriter();
+	} else {
+		_pendingDrops += 1;
+		_droppedRecords += 1;
+	}
+}
+
+/**
+ * Write output to the current log file, opening it first if the previous one was closed by rotation.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, string, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+	}
+}
+
+/**
+ * Write every record published so far, releasing the ring space of each as soon as it has been written.
+ * Only called by the writer thread, or by another thread while the writer thread is idle.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::consume(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t head = _ringHead;
+	MM_AtomicOperations::readBarrier();
+	uintptr_t tail = _ringTail;
+
+	while (tail != head) {
+		uintptr_t offset = tail & (_ringSize - 1);
+		VerboseAsyncRecordHeader *header = (VerboseAsyncRecordHeader *)(_ring + offset);
+		uintptr_t size = recordSize(header->length);
+
+		switch (header->type) {
+		case VERBOSE_ASYNC_RECORD_PAD:
+			size = _ringSize - offset;
+			break;
+		case VERBOSE_ASYNC_RECORD_TEXT:
+			writeString(env, (const char *)(header + 1), header->length);
+			break;
+		case VERBOSE_ASYNC_RECORD_DROPPED:
+		{
+			char warning[128];
+			uintptr_t count = *(uintptr_t *)(header + 1);
+			uintptr_t warningLength = omrstr_printf(warning, sizeof(warning), "<warning details=\"verbose output buffer full, %zu records dropped\" />\n", count);
+			writeString(env, warning, warningLength);
+			break;
+		}
+		case VERBOSE_ASYNC_RECORD_END_OF_CYCLE:
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+			break;
+		default:
+			Assert_MM_unreachable();
+		}
+
+		tail += size;
+		/* Finish reading the record before handing its space back to the producer */
+		MM_AtomicOperations::storeSync();
+		_ringTail = tail;
+	}
+}
+
+/**
+ * Wait until every record published so far has been written.
+ * @note The caller must hold the writer monitor, and on return the writer thread is idle until it is released,
+ * so the log file may be operated on directly.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	if (!_writerAlive) {
+		consume(env);
+		return;
+	}
+
+	while ((_ringHead != _ringTail) || _writerBusy) {
+		omrthread_monitor_notify_all(_writerMonitor);
+		omrthread_monitor_wait(_writerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flushStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	drain(env);
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+/**
+ * Closes the agent's output stream once everything queued has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	if (0 != _pendingDrops) {
+		/* There is no more output to carry the loss report, so make room for it */
+		drain(env);
+		if (enqueue(VERBOSE_ASYNC_RECORD_DROPPED, &_pendingDrops, sizeof(_pendingDrops))) {
+			_pendingDrops = 0;
+		}
+	}
+	drain(env);
+	closeFile(env);
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+/**
+ * Reconfigures the agent according to the parameters passed.
+ * Required for Dynamic verbose gc configuration.
+ * @param filename The name of the file or output stream to log to.
+ * @param fileCount The number of files to log to.
+ * @param iterations The number of gc cycles to log to each file.
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	drain(env);
+	closeFile(env);
+	/* The ring and the writer thread carry over, only the file configuration changes */
+	bool result = MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+	omrthread_monitor_exit(_writerMonitor);
+
+	return result;
+}
+
+/**
+ * Ask the writer thread to exit once the ring is empty and wait for it to do so.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopWriterThread()
+{
+	omrthread_monitor_enter(_writerMonitor);
+	_writerShutdown = true;
+	omrthread_monitor_notify_all(_writerMonitor);
+	while (_writerAlive) {
+		omrthread_monitor_wait(_writerMonitor);
+	}
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerEntryPoint()
+{
+	/* The writer thread is not attached to the VM; a VM level environment is all the file I/O needs */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_writerMonitor);
+	while (true) {
+		_writerWaiting = true;
+		/* Pairs with wakeWriter(): either the producer sees the flag or the writer sees the new head */
+		MM_AtomicOperations::sync();
+		if (_ringHead != _ringTail) {
+			_writerWaiting = false;
+			_writerBusy = true;
+			omrthread_monitor_exit(_writerMonitor);
+
+			consume(&env);
+
+			omrthread_monitor_enter(_writerMonitor);
+			_writerBusy = false;
+			/* Release anyone waiting in drain() */
+			omrthread_monitor_notify_all(_writerMonitor);
+		} else if (_writerShutdown) {
+			break;
+		} else {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+	}
+
+	_writerWaiting = false;
+	_writerAlive = false;
+	omrthread_monitor_notify_all(_writerMonitor);
+	omrthread_exit(_writerMonitor);
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Record types stored in the asynchronous writer's ring buffer.
+ */
+typedef enum {
+	VERBOSE_ASYNC_RECORD_PAD = 0, /**< Unused space at the end of the ring, skip to the start */
+	VERBOSE_ASYNC_RECORD_TEXT, /**< Formatted verbose output */
+	VERBOSE_ASYNC_RECORD_DROPPED, /**< Records were discarded because the ring was full; payload is the count */
+	VERBOSE_ASYNC_RECORD_END_OF_CYCLE /**< Cycle boundary, rotate the output files if required */
+} VerboseAsyncRecordType;
+
+/**
+ * Ouptut agent which directs verbosegc output to file from a background thread.
+ * Reporting threads only copy the formatted output into a bounded ring buffer; the file I/O, including
+ * opening, rotating and closing the log files, is performed by a dedicated writer thread so that it never
+ * extends a GC pause.  Output which does not fit in the ring is dropped and the loss is reported in the log.
+ * @note Calls to outputString() and endOfCycle() are serialized by the verbose handler's reporting lock, so
+ * the ring has a single producer and a single consumer.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	OMR_VM *_omrVM; /**< VM the writer thread builds its environment from */
+	intptr_t _logFileDescriptor; /**< the file being written to, only touched by the writer thread or while it is idle */
+
+	uint8_t *_ring; /**< ring buffer of records waiting to be written */
+	uintptr_t _ringSize; /**< size of _ring in bytes */
+	volatile uintptr_t _ringHead; /**< total bytes published by the producer */
+	volatile uintptr_t _ringTail; /**< total bytes consumed by the writer thread */
+
+	uintptr_t _pendingDrops; /**< records dropped since the last drop record made it into the ring */
+	uintptr_t _droppedRecords; /**< total records dropped because the ring was full */
+	uintptr_t _droppedBytes; /**< total bytes of output dropped because the ring was full */
+
+	omrthread_t _writerThread; /**< background writer thread */
+	omrthread_monitor_t _writerMonitor; /**< monitor guarding the writer thread state flags */
+	volatile bool _writerWaiting; /**< true while the writer thread is (about to be) blocked on an empty ring */
+	bool _writerBusy; /**< true while the writer thread is consuming records outside of the monitor */
+	bool _writerAlive; /**< true while the writer thread is running */
+	bool _writerShutdown; /**< true once the writer thread has been asked to exit */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void flushStream(MM_EnvironmentBase *env);
+	virtual void closeStream(MM_EnvironmentBase *env);
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * Main loop of the background writer thread.  Writes records as they are published and exits once
+	 * shutdown has been requested and the ring is empty.
+	 */
+	void writerEntryPoint();
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool enqueue(VerboseAsyncRecordType type, const void *payload, uintptr_t length);
+	void wakeWriter();
+	void drain(MM_EnvironmentBase *env);
+	void consume(MM_EnvironmentBase *env);
+	void writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+	void stopWriterThread();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
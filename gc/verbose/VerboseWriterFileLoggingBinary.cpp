@@ -0,0 +1,514 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+/* Initial size of the record buffer, it grows to hold the largest stanza seen */
+#define VERBOSE_BINARY_INITIAL_RECORDS_SIZE 4096
+/* Number of slots in the format table; verbose handlers use a few hundred distinct formats */
+#define VERBOSE_BINARY_FORMATS_SIZE 1024
+/* Generation of a format which has not been defined in any file yet */
+#define VERBOSE_BINARY_UNDEFINED_GENERATION ((uintptr_t)-1)
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileDescriptor(-1)
+	,_records(NULL)
+	,_recordsSize(0)
+	,_recordsUsed(0)
+	,_formats(NULL)
+	,_formatsSize(0)
+	,_formatsUsed(0)
+	,_nextFormatId(0)
+	,_fileGeneration(0)
+	,_strings()
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * Also called on reconfiguration, in which case the record buffer and format table carry over.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _records) {
+		_records = (uint8_t *)extensions->getForge()->allocate(VERBOSE_BINARY_INITIAL_RECORDS_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _records) {
+			return false;
+		}
+		_recordsSize = VERBOSE_BINARY_INITIAL_RECORDS_SIZE;
+	}
+
+	if (NULL == _formats) {
+		uintptr_t formatsBytes = VERBOSE_BINARY_FORMATS_SIZE * sizeof(VerboseBinaryFormatEntry);
+		_formats = (VerboseBinaryFormatEntry *)extensions->getForge()->allocate(formatsBytes, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _formats) {
+			return false;
+		}
+		memset(_formats, 0, formatsBytes);
+		_formatsSize = VERBOSE_BINARY_FORMATS_SIZE;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	closeFile(env);
+
+	if (NULL != _formats) {
+		for (uintptr_t i = 0; i < _formatsSize; i++) {
+			extensions->getForge()->free(_formats[i].text);
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	extensions->getForge()->free(_records);
+	_records = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the stream header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	uint8_t header[VERBOSE_BINARY_MAGIC_LENGTH + 2 + 10];
+	uint8_t *cursor = header;
+	memcpy(cursor, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+	cursor += VERBOSE_BINARY_MAGIC_LENGTH;
+	*cursor++ = VERBOSE_BINARY_VERSION;
+	*cursor++ = (uint8_t)sizeof(uintptr_t);
+	uintptr_t versionLength = strlen(version);
+	cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, versionLength);
+	omrfile_write(_logFileDescriptor, header, cursor - header);
+	omrfile_write(_logFileDescriptor, version, versionLength);
+
+	return true;
+}
+
+/**
+ * Writes any pending records and the end marker, and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	writeRecords(env);
+	if(-1 != _logFileDescriptor) {
+		uint8_t end = VERBOSE_BINARY_RECORD_END;
+		omrfile_write(_logFileDescriptor, &end, sizeof(end));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+	/* The next file starts with no formats defined and nothing cached */
+	_fileGeneration += 1;
+	_strings.reset();
+}
+
+/**
+ * Make room for size more bytes of records, flushing or growing the record buffer as required.
+ * @return the position at which to write, or NULL if the space is not available
+ */
+uint8_t *
+MM_VerboseWriterFileLoggingBinary::reserve(MM_EnvironmentBase *env, uintptr_t size)
+{
+	if ((_recordsUsed + size) > _recordsSize) {
+		uintptr_t newSize = _recordsSize;
+		while (newSize < (_recordsUsed + size)) {
+			newSize <<= 1;
+		}
+		uint8_t *newRecords = (uint8_t *)env->getExtensions()->getForge()->allocate(newSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != newRecords) {
+			memcpy(newRecords, _records, _recordsUsed);
+			env->getExtensions()->getForge()->free(_records);
+			_records = newRecords;
+			_recordsSize = newSize;
+		} else {
+			/* Make do with what we have */
+			writeRecords(env);
+			if (size > _recordsSize) {
+				return NULL;
+			}
+		}
+	}
+	return _records + _recordsUsed;
+}
+
+/**
+ * Look up, or add, the table entry of a format.
+ * @return the entry, or NULL if the table is full
+ */
+VerboseBinaryFormatEntry *
+MM_VerboseWriterFileLoggingBinary::findFormat(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t mask = _formatsSize - 1;
+	uintptr_t index = ((((uintptr_t)format) >> 2) * 2654435761U) & mask;
+
+	while (true) {
+		VerboseBinaryFormatEntry *entry = &_formats[index];
+		if (format == entry->format) {
+			if (0 != strcmp(entry->text, format)) {
+				/* The address now holds a different format, it needs an id of its own */
+				env->getExtensions()->getForge()->free(entry->text);
+				entry->text = NULL;
+				if (!defineFormat(env, entry, format)) {
+					entry->signature = NULL;
+				}
+			}
+			return entry;
+		}
+		if (NULL == entry->format) {
+			/* Keep the table sparse so that probe sequences stay short */
+			if ((_formatsUsed * 2) >= _formatsSize) {
+				return NULL;
+			}
+			_formatsUsed += 1;
+			entry->format = format;
+			if (!defineFormat(env, entry, format)) {
+				entry->signature = NULL;
+			}
+			return entry;
+		}
+		index = (index + 1) & mask;
+	}
+}
+
+/**
+ * Record a format string in the table: copy it, work out the values it consumes and give it a new id.
+ * @return true on success, false if the format cannot be represented in the stream, in which case lines
+ * using it are written as text
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::defineFormat(MM_EnvironmentBase *env, VerboseBinaryFormatEntry *entry, const char *format)
+{
+	uintptr_t valueCount = 0;
+	VerboseBinaryConversion conversion;
+	const char *cursor = format;
+	while (MM_VerboseBinaryFormat::nextConversion(cursor, &conversion)) {
+		if (VERBOSE_BINARY_ARG_UNSUPPORTED == conversion.type) {
+			return false;
+		}
+		valueCount += conversion.starCount;
+		if (VERBOSE_BINARY_ARG_NONE != conversion.type) {
+			valueCount += 1;
+		}
+		cursor = conversion.end;
+	}
+
+	uintptr_t textLength = strlen(format) + 1;
+	char *text = (char *)env->getExtensions()->getForge()->allocate(textLength + valueCount + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == text) {
+		return false;
+	}
+	memcpy(text, format, textLength);
+
+	uint8_t *signature = (uint8_t *)(text + textLength);
+	uint8_t *type = signature;
+	cursor = format;
+	while (MM_VerboseBinaryFormat::nextConversion(cursor, &conversion)) {
+		for (uintptr_t i = 0; i < conversion.starCount; i++) {
+			*type++ = VERBOSE_BINARY_ARG_U32;
+		}
+		if (VERBOSE_BINARY_ARG_NONE != conversion.type) {
+			*type++ = (uint8_t)conversion.type;
+		}
+		cursor = conversion.end;
+	}
+	*type = VERBOSE_BINARY_ARG_NONE;
+
+	entry->text = text;
+	entry->signature = signature;
+	entry->id = _nextFormatId++;
+	entry->generation = VERBOSE_BINARY_UNDEFINED_GENERATION;
+
+	return true;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::recordsLines()
+{
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	VerboseBinaryFormatEntry *entry = findFormat(env, format);
+	if ((NULL == entry) || (NULL == entry->signature)) {
+		outputText(env, indent, format, args);
+		return;
+	}
+
+	if (_fileGeneration != entry->generation) {
+		uintptr_t length = strlen(entry->text);
+		uint8_t *cursor = reserve(env, 1 + (2 * MM_VerboseBinaryFormat::maxUnsignedSize()) + length);
+		if (NULL == cursor) {
+			return;
+		}
+		*cursor++ = VERBOSE_BINARY_RECORD_DEFINE;
+		cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, entry->id);
+		cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, length);
+		memcpy(cursor, entry->text, length);
+		cursor += length;
+		_recordsUsed = cursor - _records;
+		entry->generation = _fileGeneration;
+	}
+
+	/* Size the record up front so that it is either written whole or not at all */
+	uintptr_t size = 1 + (2 * MM_VerboseBinaryFormat::maxUnsignedSize());
+	va_list argsCopy;
+	COPY_VA_LIST(argsCopy, args);
+	for (uint8_t *type = entry->signature; VERBOSE_BINARY_ARG_NONE != *type; type++) {
+		switch (*type) {
+		case VERBOSE_BINARY_ARG_U32:
+			va_arg(argsCopy, uint32_t);
+			size += MM_VerboseBinaryFormat::maxUnsignedSize();
+			break;
+		case VERBOSE_BINARY_ARG_U64:
+			va_arg(argsCopy, uint64_t);
+			size += MM_VerboseBinaryFormat::maxUnsignedSize();
+			break;
+		case VERBOSE_BINARY_ARG_POINTER:
+			va_arg(argsCopy, void *);
+			size += MM_VerboseBinaryFormat::maxUnsignedSize();
+			break;
+		case VERBOSE_BINARY_ARG_STRING:
+		{
+			const char *string = va_arg(argsCopy, const char *);
+			size += (NULL == string) ? 1 : MM_VerboseBinaryStringCache::maxEncodedSize(strlen(string));
+			break;
+		}
+		case VERBOSE_BINARY_ARG_DOUBLE:
+			va_arg(argsCopy, double);
+			size += sizeof(uint64_t);
+			break;
+		}
+	}
+	END_VA_LIST_COPY(argsCopy);
+
+	uint8_t *cursor = reserve(env, size);
+	if (NULL == cursor) {
+		return;
+	}
+	*cursor++ = VERBOSE_BINARY_RECORD_LINE;
+	cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, entry->id);
+	cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, indent);
+	for (uint8_t *type = entry->signature; VERBOSE_BINARY_ARG_NONE != *type; type++) {
+		switch (*type) {
+		case VERBOSE_BINARY_ARG_U32:
+			cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, va_arg(args, uint32_t));
+			break;
+		case VERBOSE_BINARY_ARG_U64:
+			cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, va_arg(args, uint64_t));
+			break;
+		case VERBOSE_BINARY_ARG_POINTER:
+			cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, (uintptr_t)va_arg(args, void *));
+			break;
+		case VERBOSE_BINARY_ARG_STRING:
+		{
+			const char *string = va_arg(args, const char *);
+			if (NULL == string) {
+				cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, 0);
+			} else {
+				cursor = _strings.write(cursor, string);
+			}
+			break;
+		}
+		case VERBOSE_BINARY_ARG_DOUBLE:
+		{
+			double value = va_arg(args, double);
+			uint64_t bits = 0;
+			memcpy(&bits, &value, sizeof(bits));
+			for (uintptr_t i = 0; i < sizeof(bits); i++) {
+				*cursor++ = (uint8_t)(bits >> (i * 8));
+			}
+			break;
+		}
+		}
+	}
+	_recordsUsed = cursor - _records;
+}
+
+/**
+ * Record a line as preformatted text, for formats the stream cannot represent.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::outputText(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t indentLength = indent * strlen(VERBOSEGC_INDENT_SPACER);
+
+	va_list argsCopy;
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t formattedLength = omrstr_vprintf(NULL, 0, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+
+	/* indentation, the line, and the newline which takes the place of the terminating '\0' */
+	uintptr_t length = indentLength + formattedLength + 1;
+	uint8_t *cursor = reserve(env, 1 + MM_VerboseBinaryFormat::maxUnsignedSize() + length);
+	if (NULL == cursor) {
+		return;
+	}
+	*cursor++ = VERBOSE_BINARY_RECORD_TEXT;
+	cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, length);
+	for (uintptr_t i = 0; i < indent; i++) {
+		memcpy(cursor, VERBOSEGC_INDENT_SPACER, strlen(VERBOSEGC_INDENT_SPACER));
+		cursor += strlen(VERBOSEGC_INDENT_SPACER);
+	}
+	cursor += omrstr_vprintf((char *)cursor, formattedLength + 1, format, args);
+	*cursor++ = '\n';
+	_recordsUsed = cursor - _records;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	uint8_t *cursor = reserve(env, 1 + MM_VerboseBinaryFormat::maxUnsignedSize() + length);
+	if (NULL != cursor) {
+		*cursor++ = VERBOSE_BINARY_RECORD_TEXT;
+		cursor = MM_VerboseBinaryFormat::writeUnsigned(cursor, length);
+		memcpy(cursor, string, length);
+		cursor += length;
+		_recordsUsed = cursor - _records;
+	}
+	writeRecords(env);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flushLines(MM_EnvironmentBase *env)
+{
+	writeRecords(env);
+}
+
+/**
+ * Write out pending records before the base class gets a chance to rotate the output files.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	writeRecords(env);
+	MM_VerboseWriterFileLogging::endOfCycle(env);
+}
+
+/**
+ * Write the pending records to the current log file, opening it first if the previous one was closed by rotation.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::writeRecords(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (0 == _recordsUsed) {
+		return;
+	}
+
+	if(-1 == _logFileDescriptor) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write(_logFileDescriptor, _records, _recordsUsed);
+	} else {
+		/* The records are meaningless as text; the formats and strings they define are lost with them */
+		_fileGeneration += 1;
+		_strings.reset();
+	}
+	_recordsUsed = 0;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * A format string known to the binary writer.
+ */
+typedef struct VerboseBinaryFormatEntry {
+	const char *format; /**< address of the format string as passed by the verbose handlers, used as the key */
+	char *text; /**< copy of the format string, to detect a key whose contents have changed */
+	uint8_t *signature; /**< VerboseBinaryArgType of each value the format consumes, terminated by VERBOSE_BINARY_ARG_NONE */
+	uintptr_t id; /**< id of the format in the stream */
+	uintptr_t generation; /**< file generation in which the format was last defined */
+} VerboseBinaryFormatEntry;
+
+/**
+ * Ouptut agent which directs verbosegc output to file in the compact binary format described in
+ * VerboseBinaryFormat.hpp.  Lines are never formatted: each format string is written once per file and
+ * each line only adds its raw arguments.  Use MM_VerboseBinaryConverter to turn the files back into XML.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	intptr_t _logFileDescriptor; /**< the file being written to */
+
+	uint8_t *_records; /**< records waiting for the next flush */
+	uintptr_t _recordsSize; /**< allocated size of _records */
+	uintptr_t _recordsUsed; /**< bytes of _records in use */
+
+	VerboseBinaryFormatEntry *_formats; /**< open addressed table of known formats, keyed by format address */
+	uintptr_t _formatsSize; /**< number of slots in _formats, a power of two */
+	uintptr_t _formatsUsed; /**< number of slots of _formats in use */
+	uintptr_t _nextFormatId; /**< id given to the next format defined */
+	uintptr_t _fileGeneration; /**< incremented each time a file is closed, so every file defines its own formats */
+	MM_VerboseBinaryStringCache _strings; /**< recently written %s arguments */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual bool recordsLines();
+	virtual void outputLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+	virtual void flushLines(MM_EnvironmentBase *env);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	uint8_t *reserve(MM_EnvironmentBase *env, uintptr_t size);
+	VerboseBinaryFormatEntry *findFormat(MM_EnvironmentBase *env, const char *format);
+	bool defineFormat(MM_EnvironmentBase *env, VerboseBinaryFormatEntry *entry, const char *format);
+	void outputText(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+	void writeRecords(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
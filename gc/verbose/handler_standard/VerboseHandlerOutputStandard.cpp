@@ -305,6 +305,16 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t stallTime = omrtime_hires_delta(0, workPacketStats->getStallTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	writer->formatAndOutput(env, 1, "<workpacket-info acquired=\"%zu\" released=\"%zu\" exchanged=\"%zu\" stolen=\"%zu\" stealattempts=\"%zu\" stallcount=\"%zu\" stallms=\"%llu.%03llu\" />",
+			workPacketStats->workPacketsAcquired, workPacketStats->workPacketsReleased, workPacketStats->workPacketsExchanged,
+			workPacketStats->workPacketsStolen, workPacketStats->workPacketStealAttempts,
+			workPacketStats->_workStallCount + workPacketStats->_completeStallCount, stallTime / 1000, stallTime % 1000);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -329,9 +339,25 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
-
-	handleSweepEndInternal(env, eventData);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	if (extensions->isConcurrentSweepEnabled()) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		uint64_t allocationSweepTime = omrtime_hires_delta(0, sweepStats->allocationSweepTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		/* debtbytes is left for this cycle's mutators; the remaining attributes show how the previous cycle's debt was paid */
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<lazy-sweep debtbytes=\"%zu\" allocsweepbytes=\"%zu\" allocsweepms=\"%llu.%03.3llu\" backgroundsweepbytes=\"%zu\" stwsweepbytes=\"%zu\" />",
+				sweepStats->sweepDebtBytes, sweepStats->allocationSweepBytes, allocationSweepTime / 1000, allocationSweepTime % 1000,
+				sweepStats->backgroundSweepBytes, sweepStats->completeSweepBytes);
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+	} else
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+	{
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -379,6 +405,15 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_incrementWindowBytes) {
+			uint64_t moveTime = 0;
+			uint64_t fixupTime = 0;
+			getTimeDeltaInMicroSeconds(&moveTime, compactStats->_moveStartTime, compactStats->_moveEndTime);
+			getTimeDeltaInMicroSeconds(&fixupTime, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+			writer->formatAndOutput(env, 1, "<compact-increment windowbytes=\"%zu\" heapbytes=\"%zu\" movetimems=\"%llu.%03.3llu\" fixuptimems=\"%llu.%03.3llu\" />",
+					compactStats->_incrementWindowBytes, compactStats->_incrementHeapBytes,
+					moveTime / 1000, moveTime % 1000, fixupTime / 1000, fixupTime % 1000);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -437,6 +472,19 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (extensions->scavengerWorkStealing) {
+		writer->formatAndOutput(env, 1, "<scan-cache-stealing stolen=\"%zu\" stealattempts=\"%zu\" dequeoverflow=\"%zu\" />",
+				scavengerStats->_stealScanCacheCount, scavengerStats->_stealScanCacheAttemptCount, scavengerStats->_scanCacheDequeOverflowCount);
+	}
+	if (0 != scavengerStats->_rememberedSetShardCount) {
+		/* up to 20 digits and a separator per shard */
+		char shardSizesBuffer[OMR_SUBLIST_POOL_MAX_SHARDS * 21] = "";
+		uintptr_t bufPos = 0;
+		for (uintptr_t shard = 0; shard < scavengerStats->_rememberedSetShardCount; shard++) {
+			bufPos += omrstr_printf(shardSizesBuffer + bufPos, sizeof(shardSizesBuffer) - bufPos, (0 == shard) ? "%zu" : " %zu", scavengerStats->_rememberedSetShardSizes[shard]);
+		}
+		writer->formatAndOutput(env, 1, "<remembered-set-shards count=\"%zu\" sizes=\"%s\" />", scavengerStats->_rememberedSetShardCount, shardSizesBuffer);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -856,6 +904,12 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 	MM_VerboseWriterChain* writer = _manager->getWriterChain();
 	uintptr_t bufPos = 0;
 
+	if (0 == ((MICRO_FRAGMENTATION | MACRO_FRAGMENTATION) & tenureFragmentation)) {
+		writer->formatAndOutput(env, indent, "<mem type=\"%s\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />",
+				type, (size_t) free, (size_t) total, (size_t) ((total == 0) ? 0 : ((uintptr_t)(((uint64_t)free*100) / (uint64_t)total))));
+		return;
+	}
+
 	bufPos += omrstr_printf(memInfoBuffer, INITIAL_BUFFER_SIZE, "<mem type=\"%s\" free=\"%zu\" total=\"%zu\" percent=\"%zu\"",
 			type, (size_t) free, (size_t) total, (size_t) ((total == 0) ? 0 : ((uintptr_t)(((uint64_t)free*100) / (uint64_t)total))));
 	if (MICRO_FRAGMENTATION == (MICRO_FRAGMENTATION & tenureFragmentation)) {
@@ -865,7 +919,8 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	/* the stanza is not a constant format, it must not be interpreted as one */
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -909,7 +964,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
@@ -923,6 +978,12 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 	if (stats->_scavengerEnabled) {
 		writer->formatAndOutput(env, indent, "<remembered-set count=\"%zu\" />", stats->_rememberedSetCount);
 	}
+
+	if (_extensions->newSpaceTransparentHugePages || _extensions->oldSpaceTransparentHugePages) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		writer->formatAndOutput(env, indent, "<transparent-huge-pages pagesize=\"%zu\" advisedbytes=\"%zu\" failedbytes=\"%zu\" />",
+				omrvmem_transparent_huge_page_size(), _extensions->transparentHugePageAdvisedBytes, _extensions->transparentHugePageAdviseFailedBytes);
+	}
 }
 
 void
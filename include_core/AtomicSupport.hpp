@@ -220,6 +220,44 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
 	}
 
+	/**
+	 * Hint to the processor that the cache line containing address will soon be read.
+	 * This is only a hint: it never faults, and is a no-op where no suitable instruction is available.
+	 * @param address[in] address to prefetch
+	 */
+	VMINLINE static void
+	prefetch(const void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(__GNUC__)
+		__builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(J9X86) || defined(J9HAMMER))
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#elif defined(__xlC__) && (defined(AIXPPC) || defined(LINUXPPC))
+		__dcbt((void *)address);
+#endif /* __GNUC__ */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
+	/**
+	 * Hint to the processor that the cache line containing address will soon be written.
+	 * This is only a hint: it never faults, and is a no-op where no suitable instruction is available.
+	 * @param address[in] address to prefetch
+	 */
+	VMINLINE static void
+	prefetchForWrite(void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(__GNUC__)
+		__builtin_prefetch(address, 1, 3);
+#elif defined(_MSC_VER) && (defined(J9X86) || defined(J9HAMMER))
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#elif defined(__xlC__) && (defined(AIXPPC) || defined(LINUXPPC))
+		__dcbtst(address);
+#endif /* __GNUC__ */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
 	/**
 	 * Prevents compiler reordering of reads and writes across the barrier.
 	 * This does not prevent processor reordering.
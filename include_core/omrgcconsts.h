@@ -193,6 +193,7 @@ struct ModronLnrlOptions {
 	uintptr_t spinCount1;
 	uintptr_t spinCount2;
 	uintptr_t spinCount3;
+	uintptr_t queued; /* non-zero to use a queued (MCS) lock rather than a test-and-set spinlock */
 };
 
 /* Flag used to poison collected object pointers for debugging */
@@ -434,7 +435,8 @@ typedef enum {
 	CONTRACTION_REQUIRED,
 	EXPANSION_REQUIRED,
 	LOA_RESIZE,
-	SYSTEM_GC
+	SYSTEM_GC,
+	HEAP_WALK
 } SweepCompletionReason;
 
 /**
@@ -472,6 +474,7 @@ typedef enum {
 #define OMR_SCV_TENURE_RATIO_HIGH 30
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
 #define OMR_SCV_REMSET_SIZE 16384
+#define OMR_SUBLIST_POOL_MAX_SHARDS 64
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
 
@@ -228,6 +228,16 @@
 #define OMRPORT_VMEM_NO_AFFINITY 0x00000080
 /** @} */
 
+/**
+ * @name Virtual Memory Access
+ * Advice values for omrvmem_advise_huge_pages
+ * @{
+ */
+#define OMRPORT_VMEM_HUGE_PAGES_DISABLE 0
+#define OMRPORT_VMEM_HUGE_PAGES_ENABLE 1
+#define OMRPORT_VMEM_HUGE_PAGES_COLLAPSE 2
+/** @} */
+
 /**
  * @name Timer Resolution
  * @anchor timerResolution
@@ -1377,6 +1387,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_transparent_huge_page_size "omrvmem_transparent_huge_page_size"*/
+	uintptr_t (*vmem_transparent_huge_page_size)(struct OMRPortLibrary *portLibrary);
+	/** see @ref omrvmem.c::omrvmem_advise_huge_pages "omrvmem_advise_huge_pages"*/
+	intptr_t (*vmem_advise_huge_pages)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice, struct J9PortVmemIdentifier *identifier);
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -1941,6 +1955,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_transparent_huge_page_size() privateOmrPortLibrary->vmem_transparent_huge_page_size(privateOmrPortLibrary)
+#define omrvmem_advise_huge_pages(param1,param2,param3,param4) privateOmrPortLibrary->vmem_advise_huge_pages(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
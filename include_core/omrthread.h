@@ -50,6 +50,11 @@ typedef struct J9Semaphore *j9sem_t;
 
 #include "omrthread_generated.h"
 
+/* Monitors created with J9THREAD_MONITOR_FUTEX park their blocked and waiting threads on futexes */
+#if defined(LINUX) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(J9ZTPF)
+#define OMR_THR_FUTEX_MONITORS
+#endif /* defined(LINUX) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(J9ZTPF) */
+
 #define J9THREAD_PRIORITY_MIN  0
 #define J9THREAD_PRIORITY_USER_MIN  1
 #define J9THREAD_PRIORITY_NORMAL  5
@@ -95,6 +100,8 @@ or omrthread priority value.
 #define J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED  0x8000
 #define J9THREAD_LIB_FLAG_JLMHST_ENABLED  0x10000
 #define J9THREAD_LIB_FLAG_JLM_HAS_BEEN_ENABLED  0x20000
+#define J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TIERS_ENABLED  0x40000
+#define J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED  0x80000
 #define J9THREAD_LIB_FLAG_JLM_ENABLED_ALL  (J9THREAD_LIB_FLAG_JLM_ENABLED|J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED|J9THREAD_LIB_FLAG_JLMHST_ENABLED)
 #define J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED  0x100000
 #define J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED  0x200000
@@ -138,6 +138,11 @@ typedef struct J9ThreadMonitorTracing {
 	uintptr_t volatile holdtime_count;
 	uintptr_t enter_pause_count;
 #endif /* OMR_THR_JLM_HOLD_TIMES */
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	uint64_t holdtime_ewma;
+	uintptr_t slow_ewma;
+	intptr_t spin_tier;
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 } J9ThreadMonitorTracing;
 
 #define J9_ABSTRACT_MONITOR_FIELDS_1 \
@@ -221,6 +226,7 @@ typedef struct J9ThreadAbstractMonitor {
 #define J9THREAD_MONITOR_IGNORE_ENTER  0x4000000
 #define J9THREAD_MONITOR_SLOW_ENTER  0x8000000
 #define J9THREAD_MONITOR_TRY_ENTER_SPIN  0x10000000
+#define J9THREAD_MONITOR_FUTEX  0x20000000
 #define J9THREAD_MONITOR_SPINLOCK_UNOWNED  0
 #define J9THREAD_MONITOR_SPINLOCK_OWNED  1
 #define J9THREAD_MONITOR_SPINLOCK_EXCEEDED  2
@@ -48,6 +48,9 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* Flags for omrthread_rwmutex_init */
+#define J9THREAD_RWMUTEX_READER_BIASED 0x1
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		1000 * 1000 * 1000
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -106,6 +109,7 @@ typedef struct omrthread_monitor_walk_state_t {
 #define omrthread_get_state dbg_omrthread_get_state
 #define omrthread_get_osId dbg_omrthread_get_osId
 #define omrthread_monitor_get_name dbg_omrthread_monitor_get_name
+#define omrthread_monitor_get_spin_counts dbg_omrthread_monitor_get_spin_counts
 #define omrthread_get_stack_range dbg_omrthread_get_stack_range
 #define omrthread_monitor_get_tracing dbg_omrthread_monitor_get_tracing
 #define getVMThreadRawState dbgGetVMThreadRawState
@@ -170,6 +174,17 @@ omrthread_get_osId(omrthread_t thread);
 char *
 omrthread_monitor_get_name(omrthread_monitor_t monitor);
 
+/**
+* @brief
+* @param monitor
+* @param spinCount1
+* @param spinCount2
+* @param spinCount3
+* @return intptr_t
+*/
+intptr_t
+omrthread_monitor_get_spin_counts(omrthread_monitor_t monitor, uintptr_t *spinCount1, uintptr_t *spinCount2, uintptr_t *spinCount3);
+
 /**
  * @brief
  * @param thread
@@ -1169,6 +1184,16 @@ omrthread_get_cpu_time(omrthread_t thread);
 intptr_t
 omrthread_get_cpu_time_ex(omrthread_t thread, int64_t *cpuTime);
 
+/**
+ * @brief
+ * @param threads
+ * @param count
+ * @param cpuTimes
+ * @return intptr_t
+ */
+intptr_t
+omrthread_get_cpu_times(omrthread_t *threads, uintptr_t count, int64_t *cpuTimes);
+
 
 /**
  * Return the amount of CPU time used by the entire process in nanoseconds.
@@ -42,7 +42,11 @@ typedef struct J9Thread {
 #endif /* OMR_OS_WINDOWS */
 #if defined(LINUX)
 	void *jumpBuffer;
+	clockid_t cpuClockId; /* CPU-time clock of the thread, 0 until first looked up */
 #endif /* LINUX */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	volatile uint32_t waitFutex;
+#endif /* OMR_THR_FUTEX_MONITORS */
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	uint8_t numaAffinity[128];
 #endif /* OMR_PORT_NUMA_SUPPORT */
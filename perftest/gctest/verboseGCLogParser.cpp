@@ -32,20 +32,24 @@
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
+#include "VerboseBinaryConverter.hpp"
 
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
+const char* XPATH_GET_ALL_SCAVENGE_TIME = "/verbosegc/gc-op[@type='scavenge']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* CONVERTED_FILE_PREFIX = "converted_";
 
 double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+bool analyze(char* fileName, OMRPortLibrary portLibrary);
 
 int main(void)
 {
 	int32_t totalFiles = 0;
+	int32_t failedFiles = 0;
 	intptr_t rc = 0;
 	char resultBuffer[128];
 	uintptr_t rcFile;
@@ -75,7 +79,9 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			if (!analyze(resultBuffer, portLibrary)) {
+				failedFiles++;
+			}
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -92,6 +98,8 @@ int main(void)
 
 	portLibrary.port_shutdown_library(&portLibrary);
 	omrthread_detach(NULL);
+
+	return (0 == failedFiles) ? 0 : -1;
 }
 
 double
@@ -102,16 +110,18 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
-void
+bool
 analyze(char* fileName, OMRPortLibrary portLibrary)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
+	std::vector<double> scavenge_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
+	pugi::xpath_node_set scavengeTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
 
@@ -123,6 +133,10 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minSweep = 0;
 	double avgSweep = 0;
 
+	double maxScavenge = 0;
+	double minScavenge = 0;
+	double avgScavenge = 0;
+
 	double maxExpand = 0;
 	double minExpand = 0;
 	double avgExpand = 0;
@@ -132,12 +146,34 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double avgGCDuration = 0;
 
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result result;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	if (MM_VerboseBinaryConverter::isBinaryLog(&portLibrary, fileName)) {
+		/* -Xgc:binaryLogging output, convert it back to XML first */
+		uintptr_t convertedFileLength = strlen(CONVERTED_FILE_PREFIX) + strlen(fileName) + 1;
+		char *convertedFile = (char *)omrmem_allocate_memory(convertedFileLength, OMRMEM_CATEGORY_MM);
+		if (NULL == convertedFile) {
+			omrtty_printf("Failed to allocate native memory for : %s\n", fileName);
+			return false;
+		}
+		omrstr_printf(convertedFile, convertedFileLength, "%s%s", CONVERTED_FILE_PREFIX, fileName);
+		bool converted = MM_VerboseBinaryConverter::convert(&portLibrary, fileName, convertedFile);
+		if (converted) {
+			result = doc.load_file(convertedFile);
+		}
+		omrfile_unlink(convertedFile);
+		omrmem_free_memory((void *)convertedFile);
+		if (!converted) {
+			omrtty_printf("Error converting binary log : %s\n", fileName);
+			return false;
+		}
+	} else {
+		result = doc.load_file(fileName);
+	}
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
+		return false;
 	} else {
 		omrtty_printf("\nResults for : %s\n",fileName);
 	}
@@ -156,6 +192,13 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    sweep_values.push_back(value);
 	}
 
+	scavengeTimes = doc.select_nodes(XPATH_GET_ALL_SCAVENGE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = scavengeTimes.begin(); it != scavengeTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("timems").as_double();
+	    scavenge_values.push_back(value);
+	}
+
 	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
 	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
@@ -182,6 +225,12 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgSweep = getAvg(sweep_values);
 	}
 
+	if (!scavenge_values.empty()) {
+		maxScavenge = *std::max_element(scavenge_values.begin(), scavenge_values.end());
+		minScavenge = *std::min_element(scavenge_values.begin(), scavenge_values.end());
+		avgScavenge = getAvg(scavenge_values);
+	}
+
 	if (!expand_values.empty()) {
 		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
 		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
@@ -194,14 +243,16 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgGCDuration = getAvg(gcduration_values);
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
+	omrtty_printf("            Mark           Sweep          Scavenge       Expand        GCDuration\n");
+	omrtty_printf("----------------------------------------------------------------------------------\n");
+	omrtty_printf("Max     : %f        %f        %f        %f        %f\n",
+						maxMark, maxSweep, maxScavenge, maxExpand, maxGCDuration);
+
+	omrtty_printf("Min     : %f        %f        %f        %f        %f\n",
+								minMark, minSweep, minScavenge, minExpand, minGCDuration);
 
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+	omrtty_printf("Average : %f        %f        %f        %f        %f\n\n",
+								avgMark, avgSweep, avgScavenge, avgExpand, avgGCDuration);
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	return true;
 }
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Convert a binary verbose GC log (-Xgc:binaryLogging) back into the XML the text writers produce.
+ *
+ * usage: omrverbosegcconv <binary log> <xml output>
+ */
+
+#include <stdio.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "VerboseBinaryConverter.hpp"
+
+int main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	int result = 0;
+	OMRPortLibrary portLibrary;
+
+	if (3 != argc) {
+		fprintf(stderr, "usage: %s <binary verbose GC log> <xml output>\n", argv[0]);
+		return -1;
+	}
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	if (!MM_VerboseBinaryConverter::isBinaryLog(&portLibrary, argv[1])) {
+		omrtty_printf("%s is not a binary verbose GC log\n", argv[1]);
+		result = -1;
+	} else if (!MM_VerboseBinaryConverter::convert(&portLibrary, argv[1], argv[2])) {
+		/* Whatever could be decoded has still been written out as a well formed document */
+		omrtty_printf("%s is truncated or damaged, %s is incomplete\n", argv[1], argv[2]);
+		result = -1;
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
@@ -391,3 +391,39 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Get the size of the transparent huge pages the operating system can back anonymous memory with.
+ * Memory reserved with the default page size may be promoted to pages of this size when it is
+ * advised with omrvmem_advise_huge_pages.
+ *
+ * @param [in] portLibrary port library
+ * @return the transparent huge page size in bytes, or 0 if transparent huge pages are not supported or are disabled
+ */
+uintptr_t
+omrvmem_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return 0;
+}
+
+/**
+ * Advise the operating system whether a range of memory reserved with the default page size should be
+ * backed by transparent huge pages. The advice is retained if the range is decommitted and recommitted.
+ * Ranges reserved with a large page size are already backed by huge pages and are left unchanged.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address The page aligned starting address of the range
+ * @param [in] byteAmount The size of the range, in bytes (must be a multiple of the page size)
+ * @param [in] advice One of:
+ * \arg OMRPORT_VMEM_HUGE_PAGES_DISABLE the range should only be backed by default pages
+ * \arg OMRPORT_VMEM_HUGE_PAGES_ENABLE the range should be backed by huge pages as it is touched
+ * \arg OMRPORT_VMEM_HUGE_PAGES_COLLAPSE resident memory in the range should be collapsed into huge pages now
+ * @param [in] identifier Descriptor for the virtual memory block containing the range
+ *
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+intptr_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -63,6 +63,12 @@
 #define MAP_FAILED -1
 #endif
 
+#if defined(MADV_COLLAPSE)
+#define OMRVMEM_MADV_COLLAPSE MADV_COLLAPSE
+#else /* defined(MADV_COLLAPSE) */
+#define OMRVMEM_MADV_COLLAPSE 25
+#endif /* defined(MADV_COLLAPSE) */
+
 #define INVALID_KEY -1
 #define FILE_NAME_SIZE 64
 
@@ -1873,6 +1879,78 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+uintptr_t
+omrvmem_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	uintptr_t result = 0;
+	FILE *enabledStream = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+	if (NULL != enabledStream) {
+		char enabled[128];
+		/* the active mode is bracketed, e.g. "always [madvise] never" */
+		if ((NULL != fgets(enabled, sizeof(enabled), enabledStream)) && (NULL == strstr(enabled, "[never]"))) {
+			FILE *sizeStream = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+			if (NULL != sizeStream) {
+				if (1 != fscanf(sizeStream, "%" SCNuPTR, &result)) {
+					result = 0;
+				}
+				fclose(sizeStream);
+			}
+		}
+		fclose(enabledStream);
+	}
+
+	return result;
+}
+
+intptr_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice, struct J9PortVmemIdentifier *identifier)
+{
+	intptr_t result = OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+
+	if (!rangeIsValid(identifier, address, byteAmount)) {
+		result = OMRPORT_ERROR_VMEM_INVALID_PARAMS;
+	} else if ((OMRPORT_VMEM_RESERVE_USED_MMAP != identifier->allocator) || (PPG_vmem_pageSize[0] != identifier->pageSize)) {
+		/* large page reservations (hugetlbfs or SysV shared memory) are already backed by huge pages */
+		result = 0;
+	} else if (0 == byteAmount) {
+		result = 0;
+	} else {
+		int madviseAdvice = -1;
+
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(address, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
+
+		switch (advice) {
+#if defined(MADV_HUGEPAGE)
+		case OMRPORT_VMEM_HUGE_PAGES_ENABLE:
+			madviseAdvice = MADV_HUGEPAGE;
+			break;
+		case OMRPORT_VMEM_HUGE_PAGES_DISABLE:
+			madviseAdvice = MADV_NOHUGEPAGE;
+			break;
+		case OMRPORT_VMEM_HUGE_PAGES_COLLAPSE:
+			/* not in older headers; kernels before 6.1 reject it with EINVAL */
+			madviseAdvice = OMRVMEM_MADV_COLLAPSE;
+			break;
+#endif /* defined(MADV_HUGEPAGE) */
+		default:
+			break;
+		}
+
+		if (-1 != madviseAdvice) {
+			if (0 == madvise(address, (size_t)byteAmount, madviseAdvice)) {
+				result = 0;
+			} else {
+				Trc_PRT_vmem_advise_huge_pages_failed(errno, address, byteAmount, advice);
+				result = OMRPORT_ERROR_VMEM_OPFAILED;
+			}
+		}
+	}
+
+	return result;
+}
+
 static void
 addressIterator_init(AddressIterator *iterator, ADDRESS minimum, ADDRESS maximum, uintptr_t alignment, intptr_t direction)
 {
@@ -705,6 +705,10 @@ extern J9_CFUNC int32_t
 omrvmem_get_available_physical_memory(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+extern J9_CFUNC uintptr_t
+omrvmem_transparent_huge_page_size(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC intptr_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice, struct J9PortVmemIdentifier *identifier);
 
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
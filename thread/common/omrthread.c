@@ -69,6 +69,11 @@ static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t m
 static intptr_t monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
 static intptr_t monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
 #endif /* OMR_THR_THREE_TIER_LOCKING */
+#if defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, BOOLEAN spin);
+static intptr_t monitor_wait_futex(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
+static intptr_t monitor_notify_futex(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+#endif /* OMR_THR_FUTEX_MONITORS */
 static intptr_t monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
 static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
 
@@ -1966,6 +1971,12 @@ threadAllocate(omrthread_library_t lib, int globalIsLocked)
 #if defined(J9ZOS390)
 		newThread->os_errno2 = 0;
 #endif /* J9ZOS390 */
+#if defined(OMR_THR_FUTEX_MONITORS)
+		newThread->waitFutex = 0;
+#endif /* OMR_THR_FUTEX_MONITORS */
+#if defined(LINUX)
+		newThread->cpuClockId = 0;
+#endif /* LINUX */
 #if defined(OMR_THR_JLM)
 		if (newThread) {
 			if (IS_JLM_ENABLED(newThread)) {
@@ -2795,6 +2806,13 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* A notified waiter has been requeued onto the monitor's futex word, where it can't be singled out */
+	if (IS_FUTEX_MONITOR(monitor) && OMR_ARE_ALL_BITS_SET(threadToInterrupt->flags, J9THREAD_FLAG_NOTIFIED)) {
+		omrthread_futex_wake(MONITOR_FUTEX_WORD(monitor), UINT32_MAX);
+	}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -2824,7 +2842,7 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
  * @param[in] self current thread
  * @param[in] threadToInterrupt
  * @return 1 if the thread was immediately interrupted<br>
- * 0 if the thread will be interrupted asap by a special thread.
+ * 0 if the thread will be interrupted asap by a special thread, or was waiting on a futex monitor and has been woken.
  * @note: if 1 is returned, THE THREAD MUTEX HAS BEEN RELEASED AS A SIDE EFFECT.
  * @note: Assumes caller has locked the global mutex
  * @note: Assumes caller has locked the thread mutex
@@ -2844,6 +2862,18 @@ interrupt_waiting_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	/* THE CALLER MUST HAVE THREAD_LOCK */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/*
+	 * A futex monitor waiter re-checks its flags whenever its waitFutex changes,
+	 * so it can be woken without owning the monitor.
+	 */
+	if (IS_FUTEX_MONITOR(threadToInterrupt->monitor)) {
+		threadToInterrupt->waitFutex += 1;
+		omrthread_futex_wake(&threadToInterrupt->waitFutex, 1);
+		return 0;
+	}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 #if !defined(ALWAYS_SPAWN_THREAD_TO_INTERRUPT)
 	/*
 	 * If we can enter the monitor without blocking, we don't need the
@@ -3626,6 +3656,15 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 
 #endif
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED)) {
+		monitor->flags |= J9THREAD_MONITOR_FUTEX;
+	}
+#else /* OMR_THR_FUTEX_MONITORS */
+	/* fall back to the default implementation where futexes aren't available */
+	monitor->flags &= ~(uintptr_t)J9THREAD_MONITOR_FUTEX;
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 	if (name) {
 		if (monitor->flags & J9THREAD_MONITOR_NAME_COPY) {
 			uintptr_t length = strlen(name);
@@ -3858,6 +3897,12 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 	ASSERT(monitor->owner != self);
 	ASSERT(FREE_TAG != monitor->count);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (IS_FUTEX_MONITOR(monitor)) {
+		return monitor_enter_futex(self, monitor, isAbortable, TRUE);
+	}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 	while (1) {
 
 		if (omrthread_spinlock_acquire(self, monitor) == 0) {
@@ -3959,6 +4004,187 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 }
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Enter a futex monitor.
+ *
+ * Spin on the spinlock, then park on the spinlock word until a release wakes us.
+ * A thread that may have consumed a wake-up (it parked on the word, or was requeued onto it
+ * by a notify) only takes the spinlock by swapping in SPINLOCK_EXCEEDED, so that its own
+ * release wakes the next parked thread.
+ *
+ * A parked thread can't be singled out to be aborted, so abortable enters block on the
+ * monitor's blocking queue as in monitor_enter_three_tier().
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @param[in] isAbortable SET_ABORTABLE or DONT_SET_ABORTABLE
+ * @param[in] spin FALSE if the thread may have consumed a wake-up of the monitor
+ * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
+ */
+static intptr_t
+monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, BOOLEAN spin)
+{
+	int blockedCount = 0;
+
+	ASSERT(self);
+	ASSERT(monitor);
+	ASSERT(IS_FUTEX_MONITOR(monitor));
+	ASSERT(monitor->owner != self);
+	ASSERT(FREE_TAG != monitor->count);
+
+	if (spin && (0 == omrthread_spinlock_acquire(self, monitor))) {
+		/* the spinlock was free, nobody needs to be woken */
+	} else if (SET_ABORTABLE == isAbortable) {
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_FUTEX1);
+		while (1) {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_FUTEX2);
+			if (self->flags & J9THREAD_FLAG_ABORTED) {
+				self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = 0;
+				THREAD_UNLOCK(self);
+				/* pass on any wake-up this thread consumed */
+				unblock_spinlock_threads(self, monitor);
+				MONITOR_UNLOCK(monitor);
+				omrthread_futex_wake(MONITOR_FUTEX_WORD(monitor), 1);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+			self->monitor = monitor;
+			THREAD_UNLOCK(self);
+
+			/* a release only takes MONITOR_LOCK when it finds a thread queued, so queue before marking the spinlock */
+			threadEnqueue(&monitor->blocking, self);
+			if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+				threadDequeue(&monitor->blocking, self);
+				break;
+			}
+
+			blockedCount++;
+			OMROSCOND_WAIT(self->condition, monitor->mutex);
+				break;
+			OMROSCOND_WAIT_LOOP();
+			threadDequeue(&monitor->blocking, self);
+		}
+		MONITOR_UNLOCK(monitor);
+	} else {
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_FUTEX2);
+		self->flags |= J9THREAD_FLAG_BLOCKED;
+		self->monitor = monitor;
+		THREAD_UNLOCK(self);
+
+		while (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+			blockedCount++;
+			omrthread_futex_wait(MONITOR_FUTEX_WORD(monitor), J9THREAD_MONITOR_SPINLOCK_EXCEEDED, 0);
+		}
+	}
+
+	/* We now own the monitor */
+	monitor->owner = self;
+	monitor->count = 1;
+	ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+	self->lockedmonitorcount++;
+
+	if ((self->monitor != 0) || (SET_ABORTABLE == isAbortable)) {
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER3);
+		self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+		self->monitor = 0;
+
+		if (SET_ABORTABLE == isAbortable) {
+			/* Check for abort that may have occurred after we got the monitor. */
+			if (self->flags & J9THREAD_FLAG_ABORTED) {
+				THREAD_UNLOCK(self);
+				monitor_exit(self, monitor);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+		}
+		THREAD_UNLOCK(self);
+	}
+
+	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
+
+	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
+	ASSERT(0 == self->monitor);
+
+	return 0;
+}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * Pick a monitor's spin tiers from the decaying averages of its hold time and of the
+ * fraction of enters that blocked.
+ *
+ * Each shrink step halves spinCount2 and spinCount3 of the monitor's default (or custom)
+ * spin counts and each grow step doubles them; shrinking beyond ADAPT_SPIN_TIERS_MAX_SHRINK
+ * steps disables spinning. A monitor shrinks while its average hold time exceeds
+ * adaptSpinHoldtime (when set) or while at least adaptSpinSlowPercent (ADAPT_SPIN_TIERS_SHRINK_SLOW_PERCENT
+ * when not set) of its enters block, and grows back while fewer than ADAPT_SPIN_TIERS_GROW_SLOW_PERCENT do.
+ *
+ * Must be called by the owner of the monitor.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to adapt
+ */
+void
+omrthread_adapt_spin_tiers(omrthread_t self, omrthread_monitor_t monitor)
+{
+	omrthread_library_t lib = self->library;
+	J9ThreadMonitorTracing *tracing = monitor->tracing;
+	uintptr_t shrinkSlowPercent = (0 != lib->adaptSpinSlowPercent) ? lib->adaptSpinSlowPercent : ADAPT_SPIN_TIERS_SHRINK_SLOW_PERCENT;
+	intptr_t spinTier = tracing->spin_tier;
+	uintptr_t spinCount2 = lib->defaultMonitorSpinCount2;
+	uintptr_t spinCount3 = lib->defaultMonitorSpinCount3;
+
+	ASSERT(self == monitor->owner);
+
+	if (((0 != lib->adaptSpinHoldtime) && (tracing->holdtime_ewma > lib->adaptSpinHoldtime))
+		|| ((tracing->slow_ewma * 100) >= (shrinkSlowPercent * ADAPT_SPIN_EWMA_ONE))
+	) {
+		if (spinTier <= ADAPT_SPIN_TIERS_MAX_SHRINK) {
+			spinTier += 1;
+		}
+	} else if ((tracing->slow_ewma * 100) < (ADAPT_SPIN_TIERS_GROW_SLOW_PERCENT * ADAPT_SPIN_EWMA_ONE)) {
+		if (spinTier > -ADAPT_SPIN_TIERS_MAX_GROW) {
+			spinTier -= 1;
+		}
+	}
+
+	if (spinTier == tracing->spin_tier) {
+		return;
+	}
+	tracing->spin_tier = spinTier;
+
+	if (spinTier > ADAPT_SPIN_TIERS_MAX_SHRINK) {
+		monitor->flags |= J9THREAD_MONITOR_DISABLE_SPINNING;
+		DISABLE_RAW_MONITOR_SPIN(self, monitor);
+		return;
+	}
+
+#if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
+	if (NULL != monitor->customSpinOptions) {
+		spinCount2 = monitor->customSpinOptions->customThreeTierSpinCount2;
+		spinCount3 = monitor->customSpinOptions->customThreeTierSpinCount3;
+	}
+#endif /* OMR_THR_CUSTOM_SPIN_OPTIONS */
+	if (spinTier > 0) {
+		spinCount2 = OMR_MAX(spinCount2 >> spinTier, 1);
+		spinCount3 = OMR_MAX(spinCount3 >> spinTier, 1);
+	} else {
+		spinCount2 <<= -spinTier;
+		spinCount3 <<= -spinTier;
+	}
+	if (0 != (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING)) {
+		ENABLE_RAW_MONITOR_SPIN(self, monitor);
+		monitor->flags &= ~J9THREAD_MONITOR_DISABLE_SPINNING;
+	}
+	monitor->spinCount2 = spinCount2;
+	monitor->spinCount3 = spinCount3;
+	Trc_THR_Adapt_SpinTiers((IS_OBJECT_MONITOR(monitor) ? "object" : "system"), monitor, spinTier,
+		monitor->spinCount1, spinCount2, spinCount3, tracing->holdtime_ewma, tracing->slow_ewma);
+}
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) */
+
 
 #if (defined(OMR_THR_THREE_TIER_LOCKING))
 /**
@@ -4173,6 +4399,21 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		monitor->owner = NULL;
 		UPDATE_JLM_MON_EXIT(self, monitor);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (IS_FUTEX_MONITOR(monitor)) {
+			if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+				omrthread_futex_wake(MONITOR_FUTEX_WORD(monitor), 1);
+				/* abortable enters queue themselves before marking the spinlock EXCEEDED */
+				if (NULL != monitor->blocking) {
+					MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
+					unblock_spinlock_threads(self, monitor);
+					MONITOR_UNLOCK(monitor);
+				}
+			}
+			return 0;
+		}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 #ifdef OMR_THR_THREE_TIER_LOCKING
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
@@ -4340,6 +4581,11 @@ monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintpt
 {
 	omrthread_t self = MACRO_SELF();
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (IS_FUTEX_MONITOR(monitor)) {
+		return monitor_wait_futex(self, monitor, millis, nanos, interruptible);
+	}
+#endif /* OMR_THR_FUTEX_MONITORS */
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	if (self->library->flags & J9THREAD_LIB_FLAG_FAST_NOTIFY) {
 		return monitor_wait_three_tier(self, monitor, millis, nanos, interruptible);
@@ -4842,6 +5088,210 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 }
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/*
+ * Wait on a futex monitor.
+ *
+ * The waiter parks on its own waitFutex, which is bumped after any change to its flags
+ * that should end the wait. A notify requeues the waiter onto the monitor's futex word
+ * instead of waking it, so that it's only woken when the monitor is released.
+ */
+static intptr_t
+monitor_wait_futex(omrthread_t self, omrthread_monitor_t monitor,
+				   int64_t millis, intptr_t nanos, uintptr_t interruptible)
+{
+	intptr_t count = -1;
+	uintptr_t interrupted = 0, notified = 0, priorityinterrupted = 0;
+	uintptr_t intrMask = 0;
+	uintptr_t intrFlags = 0;
+	uintptr_t timedOut = 0;
+	int64_t deadline = 0;
+
+	ASSERT(monitor);
+	ASSERT(FREE_TAG != monitor->count);
+
+	if (monitor->owner != self) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_ILLEGAL_MONITOR_STATE;
+	}
+
+	if ((millis < 0) || (nanos < 0) || (nanos >= 1000000)) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+
+	count = monitor->count;
+
+	intrMask = 0;
+	if (interruptible & J9THREAD_FLAG_INTERRUPTABLE) {
+		intrMask |= J9THREAD_FLAG_INTERRUPTED | J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+	}
+	if (interruptible & J9THREAD_FLAG_ABORTABLE) {
+		intrMask |= J9THREAD_FLAG_ABORTED;
+	}
+
+	THREAD_LOCK(self, CALLER_MONITOR_WAIT1);
+	ASSERT(0 == self->monitor);
+
+	/*
+	 * Before we wait, check if we've already been interrupted
+	 */
+	intrFlags = self->flags & intrMask;
+	if (intrFlags & J9THREAD_FLAG_INTERRUPTED) {
+		self->flags &= ~J9THREAD_FLAG_INTERRUPTED;
+		THREAD_UNLOCK(self);
+		return J9THREAD_INTERRUPTED;
+	}
+	if (intrFlags & J9THREAD_FLAG_PRIORITY_INTERRUPTED) {
+		self->flags &= ~J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+		THREAD_UNLOCK(self);
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+	if (intrFlags & J9THREAD_FLAG_ABORTED) {
+		THREAD_UNLOCK(self);
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+
+	self->flags |= (J9THREAD_FLAG_WAITING | interruptible);
+	if (millis || nanos) {
+		self->flags |= J9THREAD_FLAG_TIMER_SET;
+		deadline = omrthread_futex_deadline(millis, nanos);
+	}
+	self->monitor = monitor;
+
+	THREAD_UNLOCK(self);
+
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	if (IS_JLM_TIME_STAMPS_ENABLED(self, monitor)) {
+		UPDATE_JLM_MON_EXIT_HOLD_TIMES(self, monitor);
+		/*
+		 * If this is a pause monitor, increment this thread's pause count
+		 * so that the hold times of currently held monitors won't be measured
+		 */
+		if (monitor->flags & J9THREAD_MONITOR_JLM_TIME_STAMP_INVALIDATOR) {
+			self->tracing->pause_count++;
+		}
+	}
+#endif
+
+	ASSERT(self->flags & J9THREAD_FLAG_WAITING);
+	monitor->owner = NULL;
+	monitor->count = 0;
+
+	MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+	threadEnqueue(&monitor->waiting, self);
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_wake(MONITOR_FUTEX_WORD(monitor), 1);
+		unblock_spinlock_threads(self, monitor);
+	}
+	self->lockedmonitorcount--;
+	MONITOR_UNLOCK(monitor);
+
+	while (1) {
+		/* Sample the futex word before the flags: a change to the flags that we miss changes the word before we park. */
+		uint32_t waitFutex = self->waitFutex;
+
+		THREAD_LOCK(self, CALLER_MONITOR_WAIT2);
+		intrFlags = self->flags & intrMask;
+		interrupted = J9THR_WAIT_INTERRUPTED(intrFlags);
+		priorityinterrupted = J9THR_WAIT_PRI_INTERRUPTED(intrFlags);
+		notified = self->flags & J9THREAD_FLAG_NOTIFIED;
+		if (interrupted || priorityinterrupted || notified) {
+			timedOut = 0;
+			break;
+		}
+		if (timedOut) {
+			break;
+		}
+		THREAD_UNLOCK(self);
+
+		if (J9THREAD_TIMED_OUT == omrthread_futex_wait(&self->waitFutex, waitFutex, deadline)) {
+			timedOut = 1;
+		}
+	}
+
+	/* DONE WAITING AT THIS POINT */
+
+	if (!notified) {
+		/*
+		 * The notifier removes notified threads from the wait queue. Other threads remove themselves,
+		 * and stop notifiers from choosing them by clearing J9THREAD_FLAG_WAITING first.
+		 */
+		self->flags &= ~J9THREAD_FLAG_WAITING;
+		self->flags |= J9THREAD_FLAG_BLOCKED;
+		THREAD_UNLOCK(self);
+
+		MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT_FUTEX);
+		threadDequeue(&monitor->waiting, self);
+		MONITOR_UNLOCK(monitor);
+
+		THREAD_LOCK(self, CALLER_MONITOR_WAIT_FUTEX);
+	}
+
+	/* at this point, this thread should already be locked */
+
+	ASSERT(notified || interrupted || priorityinterrupted || timedOut);
+	/* if we were interrupted, then we'd better have been interruptible */
+	ASSERT(!interrupted || (interruptible & J9THREAD_FLAG_INTERRUPTABLE));
+	ASSERT(!priorityinterrupted || (interruptible & (J9THREAD_FLAG_INTERRUPTABLE | J9THREAD_FLAG_ABORTABLE)));
+	/* futex monitor waiters are woken without an interruptServer thread */
+	ASSERT(NULL == self->interrupter);
+
+	self->flags &= ~(J9THREAD_FLAG_WAITING | J9THREAD_FLAG_TIMER_SET
+					 | J9THREAD_FLAG_INTERRUPTABLE
+					 | J9THREAD_FLAG_NOTIFIED);
+	if (interruptible & J9THREAD_FLAG_INTERRUPTABLE) {
+		self->flags &= ~J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+	}
+	/*
+	 * The interrupt remains pending if the thread was priority-interrupted or notified.
+	 */
+	if (interrupted && !(notified || priorityinterrupted)) {
+		self->flags &= ~J9THREAD_FLAG_INTERRUPTED;
+	}
+	/*
+	 * Don't clear J9THREAD_FLAG_ABORTED.
+	 * Don't clear J9THREAD_FLAG_ABORTABLE. We don't want a hole here where the thread is
+	 * not abortable until it enters monitor_enter_futex().
+	 */
+
+	THREAD_UNLOCK(self);
+
+	/* A notified thread may have been woken by a release of the monitor, so it must not spin for it */
+	if (monitor_enter_futex(
+			self, monitor,
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			(BOOLEAN)(0 == notified))
+		== J9THREAD_INTERRUPTED_MONITOR_ENTER
+	) {
+		/* we don't own the monitor */
+		return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+	}
+	monitor->count = count;
+
+	ASSERT(monitor->owner == self);
+	ASSERT(monitor->count == count);
+	ASSERT(monitor->count >= 1);
+	ASSERT(0 == self->monitor);
+	ASSERT(NULL == self->next);
+
+	if (priorityinterrupted) {
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+	if (notified) {
+		return 0;
+	}
+	if (interrupted) {
+		return J9THREAD_INTERRUPTED;
+	}
+	if (timedOut) {
+		return J9THREAD_TIMED_OUT;
+	}
+	ASSERT(0);
+	return 0;
+}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 /**
  * Returns how many threads are currently waiting on a monitor.
  *
@@ -4943,6 +5393,11 @@ monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall)
 
 	Trc_THR_ThreadMonitorNotifyEnter(self, monitor, notifyall);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (IS_FUTEX_MONITOR(monitor)) {
+		rc = monitor_notify_futex(self, monitor, notifyall);
+	} else
+#endif /* OMR_THR_FUTEX_MONITORS */
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	if (self->library->flags & J9THREAD_LIB_FLAG_FAST_NOTIFY) {
 		rc = monitor_notify_three_tier(self, monitor, notifyall);
@@ -5081,6 +5536,65 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 }
 #endif
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/*
+ * Notify waiters of a futex monitor.
+ *
+ * Notified threads are moved from their own waitFutex onto the monitor's futex word
+ * rather than woken, so notify_all doesn't wake a herd of threads that would only block
+ * again on the monitor; each release of the monitor wakes one of them.
+ */
+static intptr_t
+monitor_notify_futex(omrthread_t self, omrthread_monitor_t monitor, int notifyall)
+{
+	omrthread_t queue, next;
+
+	ASSERT(self);
+	ASSERT(monitor);
+
+	if (monitor->owner != self) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_ILLEGAL_MONITOR_STATE;
+	}
+
+	MONITOR_LOCK(monitor, CALLER_NOTIFY_ONE_OR_ALL);
+	next = monitor->waiting;
+	while (NULL != next) {
+		BOOLEAN notified = FALSE;
+
+		queue = next;
+		next = queue->next;
+		THREAD_LOCK(queue, CALLER_NOTIFY_ONE_OR_ALL);
+		if (queue->flags & J9THREAD_FLAG_WAITING) {
+			queue->flags &= ~J9THREAD_FLAG_WAITING;
+			queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
+			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+			threadDequeue(&monitor->waiting, queue);
+
+			/* our release of the monitor must wake the requeued thread */
+			omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+			/*
+			 * Requeue while the thread is locked, so that it can't have left this wait and
+			 * parked on its waitFutex for another one.
+			 */
+			queue->waitFutex += 1;
+			if (0 != omrthread_futex_requeue(&queue->waitFutex, queue->waitFutex, MONITOR_FUTEX_WORD(monitor))) {
+				omrthread_futex_wake(&queue->waitFutex, 1);
+			}
+			notified = TRUE;
+		}
+		THREAD_UNLOCK(queue);
+
+		if (notified && !notifyall) {
+			break;
+		}
+	}
+	MONITOR_UNLOCK(monitor);
+
+	return 0;
+}
+#endif /* OMR_THR_FUTEX_MONITORS */
+
 /**
  * Acquire the threading library's global lock.
  *
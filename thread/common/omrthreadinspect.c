@@ -284,6 +284,35 @@ omrthread_monitor_get_name(omrthread_monitor_t monitor)
 	return READP(monitor->name);
 }
 
+/**
+ * Return the spin counts a three-tier monitor currently uses.
+ *
+ * These start out as the library (or custom) defaults and are changed per monitor
+ * by adaptive spinning, see omrthread_adapt_spin_tiers().
+ *
+ * @param[in] monitor (non-NULL)
+ * @param[out] spinCount1 iterations of the innermost busy loop
+ * @param[out] spinCount2 spinlock attempts between yields
+ * @param[out] spinCount3 yields before blocking
+ * @return 0 on success, -1 if the monitor does not spin (three-tier locking is not enabled)
+ */
+intptr_t
+omrthread_monitor_get_spin_counts(omrthread_monitor_t monitor, uintptr_t *spinCount1, uintptr_t *spinCount2, uintptr_t *spinCount3)
+{
+	ASSERT(monitor);
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	*spinCount1 = READU(monitor->spinCount1);
+	*spinCount2 = READU(monitor->spinCount2);
+	*spinCount3 = READU(monitor->spinCount3);
+	return 0;
+#else /* OMR_THR_THREE_TIER_LOCKING */
+	*spinCount1 = 0;
+	*spinCount2 = 0;
+	*spinCount3 = 0;
+	return -1;
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+}
+
 /**
  * Get native stack address range and size (VMDESIGN 2038)
  * @param[in] thread Current native thread
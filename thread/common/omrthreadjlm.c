@@ -191,6 +191,12 @@ jlm_adaptive_spin_init(void)
 	if (0 != *(uintptr_t *)omrthread_global("adaptSpinSlowPercentEnable")) {
 		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED;
 	}
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	if (0 != *(uintptr_t *)omrthread_global("adaptSpinTiersEnable")) {
+		/* spin tiers are picked from the hold time and slow enter averages */
+		adaptiveFlags |= (J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TIERS_ENABLED | J9THREAD_LIB_FLAG_JLM_INFO_SAMPLING_ENABLED);
+	}
+#endif /* OMR_THR_THREE_TIER_LOCKING */
 
 #if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
 	if (0 != *(uintptr_t *)omrthread_global("customAdaptSpinEnabled")) {
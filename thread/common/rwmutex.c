@@ -22,16 +22,32 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/* Reader-biased mutexes count readers in this many slots, one cache line each; a thread always uses the same slot */
+#define RWMUTEX_READER_SLOT_BITS 6
+#define RWMUTEX_READER_SLOTS ((uintptr_t)1 << RWMUTEX_READER_SLOT_BITS)
+#define RWMUTEX_READER_SLOT_SIZE 64
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_READER_SLOT_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t writerActive; /* J9THREAD_RWMUTEX_READER_BIASED only: non-zero while a writer holds the mutex or waits for readers to leave */
+	RWMutexReaderSlot *readerSlots; /* J9THREAD_RWMUTEX_READER_BIASED only: reader counts, aligned to RWMUTEX_READER_SLOT_SIZE */
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,12 +57,58 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_READER_BIASED(m)   (J9THREAD_RWMUTEX_READER_BIASED == ((m)->flags & J9THREAD_RWMUTEX_READER_BIASED))
+
+static RWMutexReaderSlot *readerSlot(omrthread_rwmutex_t mutex, omrthread_t self);
+static uintptr_t readerCount(omrthread_rwmutex_t mutex);
+static void notifyWriter(omrthread_rwmutex_t mutex);
+static intptr_t enterWriteReaderBiased(omrthread_rwmutex_t mutex, omrthread_t self, BOOLEAN block);
+
+/**
+ * Find the reader slot of a thread in a reader-biased mutex.
+ */
+static RWMutexReaderSlot *
+readerSlot(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	/* multiplicative hash of the thread address; threads sharing a slot only share its cache line */
+	uint32_t hash = (uint32_t)((uintptr_t)self >> 4) * 2654435761U;
+	return &mutex->readerSlots[hash >> (32 - RWMUTEX_READER_SLOT_BITS)];
+}
+
+/**
+ * Count the readers in a reader-biased mutex. Only exact if no reader can enter concurrently.
+ */
+static uintptr_t
+readerCount(omrthread_rwmutex_t mutex)
+{
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+	for (i = 0; i < RWMUTEX_READER_SLOTS; i++) {
+		count += mutex->readerSlots[i].count;
+	}
+	return count;
+}
+
+/**
+ * Wake a writer of a reader-biased mutex that may be waiting for readers to leave.
+ */
+static void
+notifyWriter(omrthread_rwmutex_t mutex)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+	omrthread_monitor_notify_all(mutex->syncMon);
+	omrthread_monitor_exit(mutex->syncMon);
+}
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * With J9THREAD_RWMUTEX_READER_BIASED in flags, readers are counted in per-thread slots and
+ * enter and exit without taking the internal monitor unless a writer is active. Writers pay for
+ * this by scanning the slots. Both flavours follow the same entry and re-entry rules.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
- * @param[in] flags initial flag values for the mutex
+ * @param[in] flags initial flag values for the mutex (0 or J9THREAD_RWMUTEX_READER_BIASED)
  * @return J9THREAD_RWMUTEX_OK on success
  *
  * @see omrthread_rwmutex_destroy
@@ -72,6 +134,21 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
+		mutex->flags = flags;
+		mutex->writerActive = 0;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+
+		if (RWMUTEX_READER_BIASED(mutex)) {
+			uintptr_t size = (RWMUTEX_READER_SLOTS + 1) * sizeof(RWMutexReaderSlot);
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, size, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+				omrthread_rwmutex_destroy(mutex);
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			memset(mutex->readerSlotsMemory, 0, size);
+			mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_READER_SLOT_SIZE - 1) & ~(uintptr_t)(RWMUTEX_READER_SLOT_SIZE - 1));
+		}
 
 		ASSERT(handle);
 		*handle = mutex;
@@ -103,6 +180,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +222,31 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		RWMutexReaderSlot *slot = readerSlot(mutex, self);
+		addAtomic(&slot->count, 1);
+		/* pairs with the barrier in enterWriteReaderBiased(): either the writer sees this reader or this reader sees the writer */
+		issueReadWriteBarrier();
+		if (0 == mutex->writerActive) {
+			return J9THREAD_RWMUTEX_OK;
+		}
+		subtractAtomic(&slot->count, 1);
+		issueReadWriteBarrier();
+		notifyWriter(mutex);
+
+		/* as in the default flavour, wait only for a writer that holds the mutex, so readers can re-enter while a writer waits */
+		omrthread_monitor_enter(mutex->syncMon);
+		while (mutex->status < 0) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		addAtomic(&slot->count, 1);
+		omrthread_monitor_exit(mutex->syncMon);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +273,20 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		/* finish the reads of the critical section before a writer can see this reader leave */
+		issueWriteBarrier();
+		subtractAtomic(&readerSlot(mutex, self)->count, 1);
+		issueReadWriteBarrier();
+		if (0 != mutex->writerActive) {
+			notifyWriter(mutex);
+		}
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -224,6 +339,10 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		return enterWriteReaderBiased(mutex, self, TRUE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status != 0) {
@@ -262,6 +381,10 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		return enterWriteReaderBiased(mutex, self, FALSE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
 		/* must get out */
@@ -299,6 +422,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->writerActive = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -306,6 +430,50 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	return J9THREAD_RWMUTEX_OK;
 }
 
+/**
+ * Enter a reader-biased mutex as a writer: claim the writer flag, which diverts new readers to the
+ * monitor, then wait for the readers counted in the slots to leave.
+ *
+ * @param[in] mutex a reader-biased mutex not owned by self
+ * @param[in] self the current thread
+ * @param[in] block FALSE to fail instead of waiting for other readers or writers
+ * @return J9THREAD_RWMUTEX_OK on success, J9THREAD_RWMUTEX_WOULDBLOCK if block is FALSE and the mutex is in use
+ */
+static intptr_t
+enterWriteReaderBiased(omrthread_rwmutex_t mutex, omrthread_t self, BOOLEAN block)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	while (0 != mutex->writerActive) {
+		if (!block) {
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->writerActive = 1;
+	/* pairs with the barrier in omrthread_rwmutex_enter_read() */
+	issueReadWriteBarrier();
+
+	while (0 != readerCount(mutex)) {
+		if (!block) {
+			mutex->writerActive = 0;
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->status--;
+	mutex->writer = self;
+
+	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
 /**
  * check if the mutex is in writing state.
  * for performance reason, the method would not use syncMon and
@@ -330,7 +498,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_READER_BIASED(rwmutex) && (0 != readerCount(rwmutex)))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,6 +509,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerActive = 0;
 	}
 }
 
@@ -97,6 +97,25 @@ extern intptr_t omrthread_debug_syscall(const char *func, intptr_t retval);
 intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monitor);
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING)
+void omrthread_adapt_spin_tiers(omrthread_t self, omrthread_monitor_t monitor);
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) */
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+/* omrthreadfutex.c */
+int64_t omrthread_futex_deadline(int64_t millis, intptr_t nanos);
+intptr_t omrthread_futex_wait(volatile uint32_t *address, uint32_t expected, int64_t deadline);
+void omrthread_futex_wake(volatile uint32_t *address, uint32_t count);
+intptr_t omrthread_futex_requeue(volatile uint32_t *address, uint32_t expected, volatile uint32_t *target);
+
+/* The futex word of a monitor is the low-order half of its spinlockState, which holds the whole state */
+#if defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN)
+#define MONITOR_FUTEX_WORD(monitor) (((volatile uint32_t *)&(monitor)->spinlockState) + 1)
+#else /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+#define MONITOR_FUTEX_WORD(monitor) ((volatile uint32_t *)&(monitor)->spinlockState)
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+#define IS_FUTEX_MONITOR(monitor) OMR_ARE_ALL_BITS_SET((monitor)->flags, J9THREAD_MONITOR_FUTEX)
+#endif /* OMR_THR_FUTEX_MONITORS */
 
 /*
  * constants for profiling
@@ -145,6 +164,9 @@ enum {
 	CALLER_STORE_EXIT_CPU_USAGE,
 	CALLER_GET_JVM_CPU_USAGE_INFO,
 	CALLER_SET_FLAG_ENABLE_CPU_MONITOR,
+	CALLER_MONITOR_ENTER_FUTEX1,
+	CALLER_MONITOR_ENTER_FUTEX2,
+	CALLER_MONITOR_WAIT_FUTEX,
 	CALLER_LAST_INDEX
 };
 #define MAX_CALLER_INDEX CALLER_LAST_INDEX
@@ -288,6 +310,37 @@ enum {
 #define JLM_AVERAGE_HOLDTIME(monitor) ((monitor)->tracing->holdtime_avg)
 #define JLM_SLOW_PERCENT(monitor) (((monitor)->tracing->slow_count*100)/JLM_NON_RECURSIVE_ENTER_COUNT(monitor))
 
+/* Decaying averages used to pick spin tiers: a new sample has a weight of 1/(1 << ADAPT_SPIN_EWMA_SHIFT).
+ * slow_ewma is the fraction of non-recursive enters that blocked, scaled by ADAPT_SPIN_EWMA_ONE.
+ */
+#define ADAPT_SPIN_EWMA_SHIFT 3
+#define ADAPT_SPIN_EWMA_ONE 1024
+#define ADAPT_SPIN_EWMA(average, sample) ((average) - ((average) >> ADAPT_SPIN_EWMA_SHIFT) + ((sample) >> ADAPT_SPIN_EWMA_SHIFT))
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+#define IS_ADAPT_SPIN_TIERS_ENABLED(thread) ((thread)->library->flags & J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TIERS_ENABLED)
+#else /* OMR_THR_THREE_TIER_LOCKING */
+#define IS_ADAPT_SPIN_TIERS_ENABLED(thread) (0)
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+
+#define ADAPT_UPDATE_SLOW_EWMA(thread, monitor, isSlowEnter) \
+	do { \
+		if (IS_ADAPT_SPIN_TIERS_ENABLED(thread)) { \
+			(monitor)->tracing->slow_ewma = ADAPT_SPIN_EWMA((monitor)->tracing->slow_ewma, ((isSlowEnter) ? ADAPT_SPIN_EWMA_ONE : 0)); \
+		} \
+	} while (0)
+
+#define ADAPT_UPDATE_HOLDTIME_EWMA(thread, monitor, holdTime) \
+	do { \
+		if (IS_ADAPT_SPIN_TIERS_ENABLED(thread)) { \
+			if (1 == (monitor)->tracing->holdtime_count) { \
+				(monitor)->tracing->holdtime_ewma = (holdTime); \
+			} else { \
+				(monitor)->tracing->holdtime_ewma = ADAPT_SPIN_EWMA((monitor)->tracing->holdtime_ewma, (holdTime)); \
+			} \
+		} \
+	} while (0)
+
 #define ADAPT_MONITOR_TRACE(thread, monitor, adaptTracepoint) \
 	adaptTracepoint( \
 		(IS_OBJECT_MONITOR(monitor) ? "object" : "system"), (monitor), \
@@ -348,7 +401,9 @@ enum {
 #define ADAPT_DISABLE_SPIN_CHECK(thread, monitor) \
 	do { \
 		if (IS_ADAPTIVE_SPIN_REQUIRED(monitor)) { \
-			if ((IS_ADAPT_HOLDTIME_ENABLED((thread), (monitor)) && ((monitor)->tracing->holdtime_count > 0) && (JLM_AVERAGE_HOLDTIME(monitor) > (thread)->library->adaptSpinHoldtime)) \
+			if (IS_ADAPT_SPIN_TIERS_ENABLED(thread)) { \
+				ADAPT_SPIN_TIERS_CHECK((thread), (monitor)); \
+			} else if ((IS_ADAPT_HOLDTIME_ENABLED((thread), (monitor)) && ((monitor)->tracing->holdtime_count > 0) && (JLM_AVERAGE_HOLDTIME(monitor) > (thread)->library->adaptSpinHoldtime)) \
 				|| (IS_ADAPT_SLOW_PERCENT_ENABLED((thread), (monitor)) && ((monitor)->tracing->enter_count > 100) && (JLM_SLOW_PERCENT(monitor) >= (thread)->library->adaptSpinSlowPercent)) \
 			) { \
 				if (0 == ((monitor)->flags & J9THREAD_MONITOR_DISABLE_SPINNING)) { \
@@ -365,6 +420,24 @@ enum {
 		} \
 	} while(0)
 
+/* Tiers are re-evaluated once every ADAPT_SPIN_TIERS_INTERVAL hold time samples, see omrthread_adapt_spin_tiers(). */
+#define ADAPT_SPIN_TIERS_INTERVAL 16
+#define ADAPT_SPIN_TIERS_MAX_SHRINK 4
+#define ADAPT_SPIN_TIERS_MAX_GROW 2
+#define ADAPT_SPIN_TIERS_SHRINK_SLOW_PERCENT 50
+#define ADAPT_SPIN_TIERS_GROW_SLOW_PERCENT 10
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+#define ADAPT_SPIN_TIERS_CHECK(thread, monitor) \
+	do { \
+		if (0 == ((monitor)->tracing->holdtime_count % ADAPT_SPIN_TIERS_INTERVAL)) { \
+			omrthread_adapt_spin_tiers((thread), (monitor)); \
+		} \
+	} while (0)
+#else /* OMR_THR_THREE_TIER_LOCKING */
+#define ADAPT_SPIN_TIERS_CHECK(thread, monitor)
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+
 #define ADAPT_SAMPLE_STOP_MIN_COUNT(thread, monitor) ((thread)->library->adaptSpinSampleStopCount)
 
 #define ADAPT_SAMPLE_STOP_MAX_HOLDTIME(thread, monitor) \
@@ -404,6 +477,8 @@ enum {
 #else /* OMR_THR_ADAPTIVE_SPIN */
 #define DO_ADAPT_CHECK(thread, monitor)
 #define ADAPT_DISABLE_SPIN_CHECK(thread, monitor)
+#define ADAPT_UPDATE_SLOW_EWMA(thread, monitor, isSlowEnter)
+#define ADAPT_UPDATE_HOLDTIME_EWMA(thread, monitor, holdTime)
 #define TAKE_JLM_SAMPLE(thread, monitor) IS_JLM_ENABLED(thread)
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
@@ -460,6 +535,7 @@ enum {
 			if (isRecursiveEnter) { \
 				(monitor)->tracing->recursive_count++; \
 			} else { \
+				ADAPT_UPDATE_SLOW_EWMA((self), (monitor), (isSlowEnter)); \
 				UPDATE_JLM_MON_ENTER_HOLD_TIMES((self), (monitor)); \
 			} \
 		} \
@@ -551,6 +627,7 @@ enum {
 							(monitor)->tracing->holdtime_count = holdTimeCount; \
 							(monitor)->tracing->holdtime_sum += (omrtime_t)holdTime; \
 							(monitor)->tracing->holdtime_avg = (monitor)->tracing->holdtime_sum / ((uint64_t)holdTimeCount); \
+							ADAPT_UPDATE_HOLDTIME_EWMA((self), (monitor), (uint64_t)holdTime); \
 							ADAPT_DISABLE_SPIN_CHECK((self), (monitor)); \
 						} \
 					} \
@@ -48,6 +48,7 @@ omr_add_exports(j9thr_obj
 	omrthread_monitor_flush_destroyed_monitor_list
 	omrthread_monitor_enter
 	omrthread_monitor_get_name
+	omrthread_monitor_get_spin_counts
 	omrthread_monitor_enter_abortable_using_threadId
 	omrthread_monitor_enter_using_threadId
 	omrthread_monitor_try_enter
@@ -140,6 +141,7 @@ omr_add_exports(j9thr_obj
 	omrthread_get_self_user_time
 	omrthread_get_cpu_time
 	omrthread_get_cpu_time_ex
+	omrthread_get_cpu_times
 	omrthread_get_self_cpu_time
 	omrthread_get_process_times
 
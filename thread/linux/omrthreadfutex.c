@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief futex support for monitors created with J9THREAD_MONITOR_FUTEX.
+ */
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "omrcfg.h"
+#include "threaddef.h"
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+
+#define NANOS_PER_SECOND ((int64_t)1000000000)
+
+/**
+ * Compute the absolute CLOCK_MONOTONIC deadline of a timed wait.
+ *
+ * @param[in] millis the timeout in milliseconds
+ * @param[in] nanos the additional timeout in nanoseconds
+ * @return the deadline in nanoseconds, or 0 if millis and nanos are both 0 (no timeout)
+ */
+int64_t
+omrthread_futex_deadline(int64_t millis, intptr_t nanos)
+{
+	int64_t deadline = 0;
+
+	if ((0 != millis) || (0 != nanos)) {
+		struct timespec now;
+		int64_t timeout = 0;
+
+		/* clamp the timeout so that the deadline can't overflow */
+		if (millis > (INT64_MAX / 2 / 1000000)) {
+			timeout = INT64_MAX / 2;
+		} else {
+			timeout = (millis * 1000000) + nanos;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		deadline = ((int64_t)now.tv_sec * NANOS_PER_SECOND) + now.tv_nsec + timeout;
+	}
+	return deadline;
+}
+
+/**
+ * Block the current thread while *address holds expected.
+ *
+ * The thread may return early: when woken, when *address no longer holds expected,
+ * or when interrupted by a signal. Callers must re-check their condition.
+ *
+ * @param[in] address the futex word
+ * @param[in] expected the value of the futex word the caller observed
+ * @param[in] deadline the absolute CLOCK_MONOTONIC deadline in nanoseconds, 0 to wait indefinitely
+ * @return 0 on wake-up, J9THREAD_TIMED_OUT if the deadline passed
+ */
+intptr_t
+omrthread_futex_wait(volatile uint32_t *address, uint32_t expected, int64_t deadline)
+{
+	struct timespec timeout;
+	struct timespec *timeoutPtr = NULL;
+
+	if (0 != deadline) {
+		timeout.tv_sec = (time_t)(deadline / NANOS_PER_SECOND);
+		timeout.tv_nsec = (long)(deadline % NANOS_PER_SECOND);
+		timeoutPtr = &timeout;
+	}
+	/* FUTEX_WAIT_BITSET takes an absolute timeout, which is what looping waiters need */
+	if (-1 == syscall(SYS_futex, address, FUTEX_WAIT_BITSET_PRIVATE, expected, timeoutPtr, NULL, FUTEX_BITSET_MATCH_ANY)) {
+		if (ETIMEDOUT == errno) {
+			return J9THREAD_TIMED_OUT;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Wake threads blocked on a futex word.
+ *
+ * @param[in] address the futex word
+ * @param[in] count the maximum number of threads to wake
+ */
+void
+omrthread_futex_wake(volatile uint32_t *address, uint32_t count)
+{
+	syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, (count > INT_MAX) ? INT_MAX : (int)count, NULL, NULL, 0);
+}
+
+/**
+ * Move one thread blocked on a futex word to another futex word without waking it.
+ *
+ * @param[in] address the futex word the thread is blocked on
+ * @param[in] expected the value address must still hold
+ * @param[in] target the futex word the thread is moved to
+ * @return 0 on success (including when no thread was blocked), -1 if address no longer holds expected
+ */
+intptr_t
+omrthread_futex_requeue(volatile uint32_t *address, uint32_t expected, volatile uint32_t *target)
+{
+	/* the requeue count is passed in the timeout argument */
+	if (-1 == syscall(SYS_futex, address, FUTEX_CMP_REQUEUE_PRIVATE, 0, (uintptr_t)1, target, expected)) {
+		return -1;
+	}
+	return 0;
+}
+
+#endif /* OMR_THR_FUTEX_MONITORS */
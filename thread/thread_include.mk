@@ -75,6 +75,10 @@ ifeq ($(OMR_HOST_OS),$(filter $(OMR_HOST_OS),linux linux_ztpf))
   MODULE_INCLUDES += $(THREAD_SRCDIR)linux $(THREAD_SRCDIR)unix
 endif
 
+ifeq (linux,$(OMR_HOST_OS))
+  OBJECTS += omrthreadfutex
+endif
+
 ifeq (osx,$(OMR_HOST_OS))
   vpath % $(THREAD_SRCDIR)osx
   vpath % $(THREAD_SRCDIR)unix
@@ -156,6 +160,7 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_monitor_flush_destroyed_monitor_list >>$@
 @echo omrthread_monitor_enter >>$@
 @echo omrthread_monitor_get_name >>$@
+@echo omrthread_monitor_get_spin_counts >>$@
 @echo omrthread_monitor_enter_abortable_using_threadId >>$@
 @echo omrthread_monitor_enter_using_threadId >>$@
 @echo omrthread_monitor_try_enter >>$@
@@ -248,6 +253,7 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_get_self_user_time >>$@
 @echo omrthread_get_cpu_time >>$@
 @echo omrthread_get_cpu_time_ex >>$@
+@echo omrthread_get_cpu_times >>$@
 @echo omrthread_get_self_cpu_time >>$@
 @echo omrthread_get_process_times >>$@
 